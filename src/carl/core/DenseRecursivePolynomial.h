@@ -0,0 +1,457 @@
+/**
+ * @file DenseRecursivePolynomial.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+#include "MultivariatePolynomial.h"
+#include "UnivariatePolynomial.h"
+#include "Variable.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A polynomial in few variables that is stored densely and recursively.
+ *
+ * The polynomial is a univariate polynomial in the first variable, whose coefficients are again dense recursive polynomials in the remaining
+ * variables. On every level, the coefficients are stored in a vector indexed by the exponent, hence neither monomials nor a term ordering are
+ * involved. If a polynomial has only two or three variables and most monomials up to its degree occur, as is common for projection polynomials,
+ * this is more compact than MultivariatePolynomial and arithmetic avoids all monomial operations.
+ *
+ * All polynomials involved in an operation must have the same variables in the same order.
+ * @ingroup multirp
+ */
+template<typename Coeff>
+class DenseRecursivePolynomial {
+   private:
+    /**
+     * A node on level l is a polynomial in the last l variables.
+     * On level zero it is a number, otherwise it holds the coefficients of the powers of the first of these variables without trailing zeros.
+     */
+    struct Node {
+        Coeff constant = Coeff(0);
+        std::vector<Node> coefficients;
+    };
+
+    std::vector<Variable> mVariables;
+    Node mRoot;
+
+    DenseRecursivePolynomial(std::vector<Variable> variables, Node&& root) : mVariables(std::move(variables)), mRoot(std::move(root)) {}
+
+    static bool isZero(const Node& n, std::size_t level) {
+        return level == 0 ? carl::isZero(n.constant) : n.coefficients.empty();
+    }
+    /// Removes trailing zero coefficients of a node on a positive level.
+    static void normalize(Node& n, std::size_t level) {
+        while (!n.coefficients.empty() && isZero(n.coefficients.back(), level - 1)) {
+            n.coefficients.pop_back();
+        }
+    }
+    static Node constant(const Coeff& c, std::size_t level) {
+        Node res;
+        if (level == 0) {
+            res.constant = c;
+        } else if (!carl::isZero(c)) {
+            res.coefficients.push_back(constant(c, level - 1));
+        }
+        return res;
+    }
+
+    /// Calculates a += b or a -= b.
+    static void add(Node& a, const Node& b, std::size_t level, bool negate) {
+        if (level == 0) {
+            if (negate) {
+                a.constant -= b.constant;
+            } else {
+                a.constant += b.constant;
+            }
+            return;
+        }
+        if (a.coefficients.size() < b.coefficients.size()) {
+            a.coefficients.resize(b.coefficients.size());
+        }
+        for (std::size_t i = 0; i < b.coefficients.size(); ++i) {
+            add(a.coefficients[i], b.coefficients[i], level - 1, negate);
+        }
+        normalize(a, level);
+    }
+    /// Calculates res += a * b or res -= a * b without constructing a * b.
+    static void addProduct(Node& res, const Node& a, const Node& b, std::size_t level, bool negate) {
+        if (level == 0) {
+            if (negate) {
+                res.constant -= a.constant * b.constant;
+            } else {
+                res.constant += a.constant * b.constant;
+            }
+            return;
+        }
+        if (a.coefficients.empty() || b.coefficients.empty())
+            return;
+        std::size_t size = a.coefficients.size() + b.coefficients.size() - 1;
+        if (res.coefficients.size() < size) {
+            res.coefficients.resize(size);
+        }
+        for (std::size_t i = 0; i < a.coefficients.size(); ++i) {
+            if (isZero(a.coefficients[i], level - 1))
+                continue;
+            for (std::size_t j = 0; j < b.coefficients.size(); ++j) {
+                addProduct(res.coefficients[i + j], a.coefficients[i], b.coefficients[j], level - 1, negate);
+            }
+        }
+        normalize(res, level);
+    }
+    static Node multiply(const Node& a, const Node& b, std::size_t level) {
+        Node res;
+        addProduct(res, a, b, level, false);
+        return res;
+    }
+    static Node pow(const Node& a, std::size_t exp, std::size_t level) {
+        Node res = constant(Coeff(1), level);
+        for (std::size_t i = 0; i < exp; ++i) {
+            res = multiply(res, a, level);
+        }
+        return res;
+    }
+    /// Divides a by b, assuming that b divides a.
+    static Node divide(const Node& a, const Node& b, std::size_t level) {
+        assert(!isZero(b, level));
+        if (level == 0) {
+            return constant(carl::div(a.constant, b.constant), 0);
+        }
+        Node quotient;
+        if (a.coefficients.size() < b.coefficients.size()) {
+            assert(isZero(a, level));
+            return quotient;
+        }
+        Node rem = a;
+        std::size_t degB = b.coefficients.size() - 1;
+        quotient.coefficients.resize(rem.coefficients.size() - degB);
+        while (rem.coefficients.size() > degB) {
+            std::size_t shift = rem.coefficients.size() - 1 - degB;
+            Node factor = divide(rem.coefficients.back(), b.coefficients.back(), level - 1);
+            for (std::size_t j = 0; j <= degB; ++j) {
+                addProduct(rem.coefficients[shift + j], factor, b.coefficients[j], level - 1, true);
+            }
+            assert(rem.coefficients.empty() || isZero(rem.coefficients.back(), level - 1));
+            normalize(rem, level);
+            quotient.coefficients[shift] = std::move(factor);
+        }
+        assert(isZero(rem, level));
+        normalize(quotient, level);
+        return quotient;
+    }
+    /// Divides every coefficient of a by the coefficient c.
+    static void divideCoefficients(Node& a, const Node& c, std::size_t level) {
+        for (auto& coeff : a.coefficients) {
+            coeff = divide(coeff, c, level - 1);
+        }
+    }
+    /// Calculates the pseudo remainder of a and b with respect to the first variable.
+    static Node pseudoRemainder(const Node& a, const Node& b, std::size_t level) {
+        assert(!isZero(b, level));
+        Node rem = a;
+        std::size_t degB = b.coefficients.size() - 1;
+        if (rem.coefficients.size() <= degB) {
+            return rem;
+        }
+        std::size_t steps = rem.coefficients.size() - degB;
+        const Node& lc = b.coefficients.back();
+        while (rem.coefficients.size() > degB) {
+            std::size_t shift = rem.coefficients.size() - 1 - degB;
+            Node factor = std::move(rem.coefficients.back());
+            rem.coefficients.pop_back();
+            for (auto& coeff : rem.coefficients) {
+                coeff = multiply(coeff, lc, level - 1);
+            }
+            for (std::size_t j = 0; j < degB; ++j) {
+                addProduct(rem.coefficients[shift + j], factor, b.coefficients[j], level - 1, true);
+            }
+            normalize(rem, level);
+            --steps;
+        }
+        if (steps > 0) {
+            Node factor = pow(lc, steps, level - 1);
+            for (auto& coeff : rem.coefficients) {
+                coeff = multiply(coeff, factor, level - 1);
+            }
+        }
+        return rem;
+    }
+    static Coeff evaluate(const Node& n, std::size_t level, const Coeff* values) {
+        if (level == 0)
+            return n.constant;
+        Coeff res(0);
+        for (auto it = n.coefficients.rbegin(); it != n.coefficients.rend(); ++it) {
+            res = res * values[0] + evaluate(*it, level - 1, values + 1);
+        }
+        return res;
+    }
+    static bool equal(const Node& a, const Node& b, std::size_t level) {
+        if (level == 0)
+            return a.constant == b.constant;
+        if (a.coefficients.size() != b.coefficients.size())
+            return false;
+        for (std::size_t i = 0; i < a.coefficients.size(); ++i) {
+            if (!equal(a.coefficients[i], b.coefficients[i], level - 1))
+                return false;
+        }
+        return true;
+    }
+
+    /// Adds the terms of p to n, the variables of p are mapped to levels by variables.
+    template<typename O, typename P>
+    static void insert(Node& n, std::size_t level, const MultivariatePolynomial<Coeff, O, P>& p, const std::vector<Variable>& variables, std::size_t offset) {
+        std::vector<exponent> exps(level);
+        for (const auto& term : p) {
+            std::fill(exps.begin(), exps.end(), 0);
+            if (term.monomial()) {
+                for (const auto& ve : *term.monomial()) {
+                    auto it = std::find(variables.begin() + long(offset), variables.end(), ve.first);
+                    assert(it != variables.end());
+                    exps[std::size_t(it - variables.begin()) - offset] = ve.second;
+                }
+            }
+            Node* cur = &n;
+            for (std::size_t l = 0; l < level; ++l) {
+                if (cur->coefficients.size() <= exps[l]) {
+                    cur->coefficients.resize(exps[l] + 1);
+                }
+                cur = &cur->coefficients[exps[l]];
+            }
+            cur->constant += term.coeff();
+        }
+    }
+    /// Collects the terms of n, which is a polynomial in variables starting at offset.
+    void collect(const Node& n, std::size_t level, std::vector<exponent>& exps, std::vector<Term<Coeff>>& terms, const std::vector<std::size_t>& order) const {
+        if (level == 0) {
+            if (carl::isZero(n.constant))
+                return;
+            Monomial::Content content;
+            exponent tdeg = 0;
+            for (std::size_t i : order) {
+                if (exps[i] > 0) {
+                    content.emplace_back(mVariables[i], exps[i]);
+                    tdeg += exps[i];
+                }
+            }
+            terms.emplace_back(n.constant, content.empty() ? nullptr : createMonomial(std::move(content), tdeg));
+            return;
+        }
+        std::size_t var = mVariables.size() - level;
+        for (std::size_t i = 0; i < n.coefficients.size(); ++i) {
+            exps[var] = exponent(i);
+            collect(n.coefficients[i], level - 1, exps, terms, order);
+        }
+        exps[var] = 0;
+    }
+
+   public:
+    /**
+     * Constructs the zero polynomial.
+     * @param variables Variables, the first one being the main variable.
+     */
+    explicit DenseRecursivePolynomial(std::vector<Variable> variables) : mVariables(std::move(variables)) {}
+
+    /**
+     * Converts a multivariate polynomial.
+     * @param p Polynomial.
+     * @param variables Variables, must contain all variables of p. The first one is the main variable.
+     */
+    template<typename O, typename P>
+    DenseRecursivePolynomial(const MultivariatePolynomial<Coeff, O, P>& p, std::vector<Variable> variables) : mVariables(std::move(variables)) {
+        insert(mRoot, mVariables.size(), p, mVariables, 0);
+    }
+
+    /**
+     * Converts a univariate polynomial with multivariate coefficients.
+     * @param p Polynomial.
+     * @param variables Variables of the coefficients, must contain all variables of the coefficients except for the main variable of p.
+     */
+    template<typename O, typename P>
+    DenseRecursivePolynomial(const UnivariatePolynomial<MultivariatePolynomial<Coeff, O, P>>& p, const std::vector<Variable>& variables) {
+        mVariables.reserve(variables.size() + 1);
+        mVariables.push_back(p.mainVar());
+        mVariables.insert(mVariables.end(), variables.begin(), variables.end());
+        mRoot.coefficients.resize(p.coefficients().size());
+        for (std::size_t i = 0; i < p.coefficients().size(); ++i) {
+            insert(mRoot.coefficients[i], variables.size(), p.coefficients()[i], mVariables, 1);
+        }
+        normalize(mRoot, mVariables.size());
+    }
+
+    /**
+     * @return Variables, the first one being the main variable.
+     */
+    const std::vector<Variable>& variables() const {
+        return mVariables;
+    }
+
+    bool isZero() const {
+        return isZero(mRoot, mVariables.size());
+    }
+
+    /**
+     * @return Degree in the main variable.
+     */
+    std::size_t degree() const {
+        if (mVariables.empty() || mRoot.coefficients.empty())
+            return 0;
+        return mRoot.coefficients.size() - 1;
+    }
+
+    /**
+     * Evaluates the polynomial.
+     * @param values Values of the variables, ordered like variables().
+     * @return Value of the polynomial.
+     */
+    Coeff evaluate(const std::vector<Coeff>& values) const {
+        assert(values.size() == mVariables.size());
+        return evaluate(mRoot, mVariables.size(), values.data());
+    }
+
+    /**
+     * Converts to a multivariate polynomial.
+     */
+    template<typename O = NotRelevant, typename P = StdMultivariatePolynomialPolicies<>>
+    MultivariatePolynomial<Coeff, O, P> toMultivariatePolynomial() const {
+        // Indices of the variables in the order of the variables within a monomial.
+        std::vector<std::size_t> order(mVariables.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) { return mVariables[a] < mVariables[b]; });
+        std::vector<exponent> exps(mVariables.size(), 0);
+        std::vector<Term<Coeff>> terms;
+        collect(mRoot, mVariables.size(), exps, terms, order);
+        return MultivariatePolynomial<Coeff, O, P>(std::move(terms), false, false);
+    }
+
+    /**
+     * Converts to a univariate polynomial in the main variable with multivariate coefficients.
+     */
+    template<typename O = NotRelevant, typename P = StdMultivariatePolynomialPolicies<>>
+    UnivariatePolynomial<MultivariatePolynomial<Coeff, O, P>> toUnivariatePolynomial() const {
+        assert(!mVariables.empty());
+        DenseRecursivePolynomial coeff(std::vector<Variable>(mVariables.begin() + 1, mVariables.end()));
+        std::vector<MultivariatePolynomial<Coeff, O, P>> coeffs;
+        coeffs.reserve(mRoot.coefficients.size());
+        for (const auto& c : mRoot.coefficients) {
+            coeff.mRoot = c;
+            coeffs.push_back(coeff.template toMultivariatePolynomial<O, P>());
+        }
+        return UnivariatePolynomial<MultivariatePolynomial<Coeff, O, P>>(mVariables.front(), std::move(coeffs));
+    }
+
+    DenseRecursivePolynomial& operator+=(const DenseRecursivePolynomial& rhs) {
+        assert(mVariables == rhs.mVariables);
+        add(mRoot, rhs.mRoot, mVariables.size(), false);
+        return *this;
+    }
+    DenseRecursivePolynomial& operator-=(const DenseRecursivePolynomial& rhs) {
+        assert(mVariables == rhs.mVariables);
+        add(mRoot, rhs.mRoot, mVariables.size(), true);
+        return *this;
+    }
+    DenseRecursivePolynomial& operator*=(const DenseRecursivePolynomial& rhs) {
+        assert(mVariables == rhs.mVariables);
+        mRoot = multiply(mRoot, rhs.mRoot, mVariables.size());
+        return *this;
+    }
+
+    /**
+     * Calculates the resultant of two polynomials with respect to the main variable.
+     * Uses the subresultant pseudo remainder sequence, all divisions are exact.
+     * @param p First polynomial.
+     * @param q Second polynomial.
+     * @return Resultant, a polynomial in the remaining variables.
+     */
+    friend DenseRecursivePolynomial resultant(const DenseRecursivePolynomial& p, const DenseRecursivePolynomial& q) {
+        assert(p.mVariables == q.mVariables);
+        assert(!p.mVariables.empty());
+        std::size_t level = p.mVariables.size();
+        DenseRecursivePolynomial res(std::vector<Variable>(p.mVariables.begin() + 1, p.mVariables.end()));
+        if (p.isZero() || q.isZero()) {
+            return res;
+        }
+        const Node* a = &p.mRoot;
+        const Node* b = &q.mRoot;
+        bool negate = false;
+        if (a->coefficients.size() < b->coefficients.size()) {
+            std::swap(a, b);
+            negate = (a->coefficients.size() % 2 == 0) && (b->coefficients.size() % 2 == 0);
+        }
+        Node A = *a;
+        Node B = *b;
+        Node g = constant(Coeff(1), level - 1);
+        Node h = constant(Coeff(1), level - 1);
+        while (B.coefficients.size() > 1) {
+            std::size_t degA = A.coefficients.size() - 1;
+            std::size_t degB = B.coefficients.size() - 1;
+            std::size_t delta = degA - degB;
+            if (degA % 2 == 1 && degB % 2 == 1) {
+                negate = !negate;
+            }
+            Node R = pseudoRemainder(A, B, level);
+            if (isZero(R, level)) {
+                return res;
+            }
+            A = std::move(B);
+            B = std::move(R);
+            divideCoefficients(B, multiply(g, pow(h, delta, level - 1), level - 1), level);
+            g = A.coefficients.back();
+            // h = h^(1-delta) * g^delta
+            if (delta == 0) {
+                // h is unchanged.
+            } else if (delta == 1) {
+                h = g;
+            } else {
+                h = divide(pow(g, delta, level - 1), pow(h, delta - 1, level - 1), level - 1);
+            }
+        }
+        // B is a non-zero constant in the main variable.
+        std::size_t degA = A.coefficients.size() - 1;
+        if (degA == 0) {
+            res.mRoot = constant(Coeff(1), level - 1);
+        } else {
+            res.mRoot = divide(pow(B.coefficients.front(), degA, level - 1), pow(h, degA - 1, level - 1), level - 1);
+        }
+        if (negate) {
+            Node zero;
+            add(zero, res.mRoot, level - 1, true);
+            res.mRoot = std::move(zero);
+        }
+        return res;
+    }
+
+    friend bool operator==(const DenseRecursivePolynomial& lhs, const DenseRecursivePolynomial& rhs) {
+        return lhs.mVariables == rhs.mVariables && equal(lhs.mRoot, rhs.mRoot, lhs.mVariables.size());
+    }
+    friend bool operator!=(const DenseRecursivePolynomial& lhs, const DenseRecursivePolynomial& rhs) {
+        return !(lhs == rhs);
+    }
+    friend std::ostream& operator<<(std::ostream& os, const DenseRecursivePolynomial& p) {
+        return os << p.toMultivariatePolynomial();
+    }
+};
+
+template<typename Coeff>
+inline DenseRecursivePolynomial<Coeff> operator+(const DenseRecursivePolynomial<Coeff>& lhs, const DenseRecursivePolynomial<Coeff>& rhs) {
+    return DenseRecursivePolynomial<Coeff>(lhs) += rhs;
+}
+template<typename Coeff>
+inline DenseRecursivePolynomial<Coeff> operator-(const DenseRecursivePolynomial<Coeff>& lhs, const DenseRecursivePolynomial<Coeff>& rhs) {
+    return DenseRecursivePolynomial<Coeff>(lhs) -= rhs;
+}
+template<typename Coeff>
+inline DenseRecursivePolynomial<Coeff> operator*(const DenseRecursivePolynomial<Coeff>& lhs, const DenseRecursivePolynomial<Coeff>& rhs) {
+    return DenseRecursivePolynomial<Coeff>(lhs) *= rhs;
+}
+
+}  // namespace carl
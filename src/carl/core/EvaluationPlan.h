@@ -0,0 +1,465 @@
+/**
+ * @file EvaluationPlan.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../interval/Interval.h"
+#include "../numbers/numbers.h"
+#include "MultivariatePolynomial.h"
+#include "Variable.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace carl {
+
+namespace detail {
+/**
+ * Converts coefficients to the type an evaluation plan computes with.
+ */
+template<typename T>
+struct EvaluationValue {
+    template<typename C>
+    static T convert(const C& c) {
+        return T(c);
+    }
+};
+template<>
+struct EvaluationValue<double> {
+    template<typename C>
+    static double convert(const C& c) {
+        return carl::toDouble(c);
+    }
+};
+template<>
+struct EvaluationValue<Interval<double>> {
+    /// Coefficients that are not representable as double are overapproximated.
+    template<typename C>
+    static Interval<double> convert(const C& c) {
+        return Interval<double>(carl::roundDown(c), carl::roundUp(c));
+    }
+};
+
+/**
+ * Elementwise operations on blocks of values.
+ * An operand with stride zero is a single value that is used for every element.
+ */
+template<typename T>
+struct EvaluationKernel {
+    static void add(T* out, const T* lhs, std::size_t lhsStride, const T* rhs, std::size_t rhsStride, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i * lhsStride] + rhs[i * rhsStride];
+        }
+    }
+    static void mul(T* out, const T* lhs, std::size_t lhsStride, const T* rhs, std::size_t rhsStride, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = lhs[i * lhsStride] * rhs[i * rhsStride];
+        }
+    }
+    /**
+     * Computes a single power, used by EvaluationPlan::evaluate() such that it agrees with the blockwise operations.
+     */
+    static T pow(const T& base, uint exp) {
+        return carl::pow(base, exp);
+    }
+    static void pow(T* out, const T* base, std::size_t baseStride, uint exp, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = pow(base[i * baseStride], exp);
+        }
+    }
+};
+#ifdef __SSE2__
+/**
+ * Processes two doubles at once.
+ * As all elements share the same exponent, powers are computed by binary exponentiation on whole vectors. Single powers are computed by the
+ * same sequence of multiplications, hence all points yield the same results as EvaluationPlan::evaluate().
+ */
+template<>
+struct EvaluationKernel<double> {
+    static __m128d load(const double* p, std::size_t stride, std::size_t i) {
+        return stride == 0 ? _mm_set1_pd(*p) : _mm_loadu_pd(p + i);
+    }
+    static void add(double* out, const double* lhs, std::size_t lhsStride, const double* rhs, std::size_t rhsStride, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(out + i, _mm_add_pd(load(lhs, lhsStride, i), load(rhs, rhsStride, i)));
+        }
+        for (; i < n; ++i) {
+            out[i] = lhs[i * lhsStride] + rhs[i * rhsStride];
+        }
+    }
+    static void mul(double* out, const double* lhs, std::size_t lhsStride, const double* rhs, std::size_t rhsStride, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(out + i, _mm_mul_pd(load(lhs, lhsStride, i), load(rhs, rhsStride, i)));
+        }
+        for (; i < n; ++i) {
+            out[i] = lhs[i * lhsStride] * rhs[i * rhsStride];
+        }
+    }
+    static double pow(double base, uint exp) {
+        double res = 1.0;
+        for (uint e = exp; e > 0; e >>= 1) {
+            if (e & 1)
+                res *= base;
+            base *= base;
+        }
+        return res;
+    }
+    static void pow(double* out, const double* base, std::size_t baseStride, uint exp, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d b = load(base, baseStride, i);
+            __m128d res = _mm_set1_pd(1.0);
+            for (uint e = exp; e > 0; e >>= 1) {
+                if (e & 1)
+                    res = _mm_mul_pd(res, b);
+                b = _mm_mul_pd(b, b);
+            }
+            _mm_storeu_pd(out + i, res);
+        }
+        for (; i < n; ++i) {
+            out[i] = pow(base[i * baseStride], exp);
+        }
+    }
+};
+#endif
+}  // namespace detail
+
+/**
+ * A polynomial compiled for repeated evaluation.
+ *
+ * The polynomial is translated once into a flat sequence of additions, multiplications and powers.
+ * Variables are resolved to slots of a dense value vector, every power of a variable is computed only once per evaluation and the terms are
+ * factored in a Horner scheme, always factoring out the variable that occurs in most terms.
+ * Coefficients are converted to T when the plan is built.
+ *
+ * T may be any type with additions, multiplications and carl::pow(), in particular mpq_class, double and Interval<Number>.
+ * A plan can also be evaluated on a block of points at once, which executes every instruction for all points before proceeding with the next
+ * one. For double, the instructions are vectorized if SSE2 is available.
+ * Evaluating an interval plan yields an enclosure of the range of the polynomial, which may differ from IntervalEvaluation::evaluate() due to
+ * the Horner scheme.
+ * @ingroup multirp
+ */
+template<typename T>
+class EvaluationPlan {
+   private:
+    /// Where an operand is stored.
+    enum class Source { Value, Constant, Register };
+    struct Operand {
+        Source source;
+        std::size_t index;
+    };
+    enum class Operation { Add, Mul, Pow };
+    struct Instruction {
+        Operation op;
+        std::size_t target;
+        Operand lhs;
+        Operand rhs;
+        uint exponent;
+    };
+    /// A term as coefficient and exponents of variable slots.
+    template<typename Coeff>
+    using CompileTerm = std::pair<Coeff, std::vector<std::pair<std::size_t, uint>>>;
+
+    /// Number of points that are processed at once by evaluateBatch().
+    static constexpr std::size_t BlockSize = 256;
+
+    /// Variables in the order of the value vector.
+    std::vector<Variable> mVariables;
+    std::vector<T> mConstants;
+    std::vector<Instruction> mProgram;
+    std::size_t mRegisters = 0;
+    Operand mResult = {Source::Constant, 0};
+    /// Powers of variables that have already been computed, indexed by slot and exponent.
+    std::map<std::pair<std::size_t, uint>, Operand> mPowers;
+
+    Operand constant(T&& c) {
+        mConstants.push_back(std::move(c));
+        return {Source::Constant, mConstants.size() - 1};
+    }
+    template<typename C>
+    Operand constant(const C& c) {
+        return constant(detail::EvaluationValue<T>::convert(c));
+    }
+    Operand emit(Operation op, Operand lhs, Operand rhs, uint exponent = 0) {
+        mProgram.push_back({op, mRegisters, lhs, rhs, exponent});
+        return {Source::Register, mRegisters++};
+    }
+    Operand power(std::size_t slot, uint exponent) {
+        Operand var = {Source::Value, slot};
+        if (exponent == 1)
+            return var;
+        auto it = mPowers.find(std::make_pair(slot, exponent));
+        if (it != mPowers.end())
+            return it->second;
+        Operand res = emit(Operation::Pow, var, var, exponent);
+        mPowers.emplace(std::make_pair(slot, exponent), res);
+        return res;
+    }
+
+    /// Multiplies with an optional operand, no operand representing one.
+    Operand multiply(const std::optional<Operand>& lhs, Operand rhs) {
+        return lhs ? emit(Operation::Mul, *lhs, rhs) : rhs;
+    }
+    Operand value(const std::optional<Operand>& o) {
+        return o ? *o : constant(T(constant_one<T>::get()));
+    }
+
+    /**
+     * Compiles a single term.
+     * @return Operand holding the value of the term, nothing if it is one.
+     */
+    template<typename Coeff>
+    std::optional<Operand> compileMonomial(const CompileTerm<Coeff>& term) {
+        std::optional<Operand> res;
+        if (!carl::isOne(term.first)) {
+            res = constant(term.first);
+        }
+        for (const auto& ve : term.second) {
+            res = multiply(res, power(ve.first, ve.second));
+        }
+        return res;
+    }
+
+    /**
+     * Compiles a sum of terms.
+     * Terms whose exponents become empty are constant.
+     * @return Operand holding the value of the sum, nothing if it is one.
+     */
+    template<typename Coeff>
+    std::optional<Operand> compile(std::vector<CompileTerm<Coeff>>& terms) {
+        assert(!terms.empty());
+        if (terms.size() == 1) {
+            return compileMonomial(terms.front());
+        }
+        // Select the slot that occurs in most terms.
+        std::map<std::size_t, std::size_t> occurrences;
+        for (const auto& t : terms) {
+            for (const auto& ve : t.second) {
+                ++occurrences[ve.first];
+            }
+        }
+        if (occurrences.empty()) {
+            Coeff sum = constant_zero<Coeff>::get();
+            for (const auto& t : terms) {
+                sum += t.first;
+            }
+            return compileMonomial(CompileTerm<Coeff>(sum, {}));
+        }
+        std::size_t slot = std::max_element(occurrences.begin(), occurrences.end(), [](const auto& lhs, const auto& rhs) {
+                               return lhs.second < rhs.second;
+                           })->first;
+        // Group the terms containing the slot by its exponent, removing the slot from the terms.
+        std::map<uint, std::vector<CompileTerm<Coeff>>, std::greater<uint>> dependent;
+        std::vector<CompileTerm<Coeff>> independent;
+        for (auto& t : terms) {
+            auto it = std::find_if(t.second.begin(), t.second.end(), [slot](const auto& ve) { return ve.first == slot; });
+            if (it == t.second.end()) {
+                independent.push_back(std::move(t));
+            } else {
+                uint exp = it->second;
+                t.second.erase(it);
+                dependent[exp].push_back(std::move(t));
+            }
+        }
+        // Horner scheme: ((c_k * x^(e_k - e_{k-1}) + c_{k-1}) * x^(e_{k-1} - e_{k-2}) + ...) * x^e_1
+        auto it = dependent.begin();
+        std::optional<Operand> res = compile(it->second);
+        uint exp = it->first;
+        for (++it; it != dependent.end(); ++it) {
+            Operand prod = multiply(res, power(slot, exp - it->first));
+            res = emit(Operation::Add, prod, value(compile(it->second)));
+            exp = it->first;
+        }
+        Operand sum = multiply(res, power(slot, exp));
+        if (!independent.empty()) {
+            sum = emit(Operation::Add, sum, value(compile(independent)));
+        }
+        return sum;
+    }
+
+    const T& get(const Operand& o, const std::vector<T>& values, const std::vector<T>& registers) const {
+        switch (o.source) {
+            case Source::Value:
+                return values[o.index];
+            case Source::Constant:
+                return mConstants[o.index];
+            default:
+                return registers[o.index];
+        }
+    }
+
+   public:
+    /**
+     * Compiles a polynomial, using its variables in ascending order as slots.
+     * @param p Polynomial.
+     */
+    template<typename Coeff, typename Ordering, typename Policies>
+    explicit EvaluationPlan(const MultivariatePolynomial<Coeff, Ordering, Policies>& p)
+        : EvaluationPlan(p, [&p]() {
+              std::set<Variable> vars = p.gatherVariables();
+              return std::vector<Variable>(vars.begin(), vars.end());
+          }()) {}
+
+    /**
+     * Compiles a polynomial for the given order of variables.
+     * This allows multiple plans to share value vectors.
+     * @param p Polynomial.
+     * @param variables Variables in the order of the value vector, must contain all variables of p.
+     */
+    template<typename Coeff, typename Ordering, typename Policies>
+    EvaluationPlan(const MultivariatePolynomial<Coeff, Ordering, Policies>& p, std::vector<Variable> variables) : mVariables(std::move(variables)) {
+        if (p.isZero()) {
+            mResult = constant(constant_zero<Coeff>::get());
+            return;
+        }
+        std::map<Variable, std::size_t> slots;
+        for (std::size_t i = 0; i < mVariables.size(); ++i) {
+            slots.emplace(mVariables[i], i);
+        }
+        std::vector<CompileTerm<Coeff>> terms;
+        terms.reserve(p.nrTerms());
+        for (const auto& t : p) {
+            CompileTerm<Coeff> term(t.coeff(), {});
+            if (t.monomial()) {
+                for (const auto& ve : *t.monomial()) {
+                    assert(slots.find(ve.first) != slots.end());
+                    term.second.emplace_back(slots.at(ve.first), ve.second);
+                }
+            }
+            terms.push_back(std::move(term));
+        }
+        mResult = value(compile(terms));
+        mPowers.clear();
+    }
+
+    /**
+     * @return Variables in the order of the value vector.
+     */
+    const std::vector<Variable>& variables() const {
+        return mVariables;
+    }
+    /**
+     * @return Number of instructions.
+     */
+    std::size_t size() const {
+        return mProgram.size();
+    }
+
+    /**
+     * Evaluates the polynomial.
+     * @param values Values of the variables, ordered like variables().
+     * @param registers Storage for intermediate results, may be reused for subsequent evaluations to avoid allocations.
+     * @return Value of the polynomial.
+     */
+    T evaluate(const std::vector<T>& values, std::vector<T>& registers) const {
+        assert(values.size() == mVariables.size());
+        registers.resize(mRegisters);
+        for (const auto& i : mProgram) {
+            const T& lhs = get(i.lhs, values, registers);
+            switch (i.op) {
+                case Operation::Add:
+                    registers[i.target] = lhs + get(i.rhs, values, registers);
+                    break;
+                case Operation::Mul:
+                    registers[i.target] = lhs * get(i.rhs, values, registers);
+                    break;
+                case Operation::Pow:
+                    registers[i.target] = detail::EvaluationKernel<T>::pow(lhs, i.exponent);
+                    break;
+            }
+        }
+        return get(mResult, values, registers);
+    }
+
+    /**
+     * Evaluates the polynomial.
+     * @param values Values of the variables, ordered like variables().
+     * @return Value of the polynomial.
+     */
+    T evaluate(const std::vector<T>& values) const {
+        std::vector<T> registers;
+        return evaluate(values, registers);
+    }
+
+    /**
+     * Evaluates the polynomial at multiple points.
+     * The points are given as structure of arrays, i.e. values[i][j] is the value of the i'th variable at the j'th point.
+     * @param values Values of the variables, ordered like variables(), all of the same length.
+     * @param registers Storage for intermediate results, may be reused for subsequent evaluations to avoid allocations.
+     * @param points Number of points, only relevant if there are no variables.
+     * @return Values of the polynomial at all points.
+     */
+    std::vector<T> evaluateBatch(const std::vector<std::vector<T>>& values, std::vector<std::vector<T>>& registers, std::size_t points = 1) const {
+        assert(values.size() == mVariables.size());
+        if (!values.empty()) {
+            points = values.front().size();
+        }
+        assert(std::all_of(values.begin(), values.end(), [points](const auto& v) { return v.size() == points; }));
+        registers.resize(mRegisters);
+        for (auto& r : registers) {
+            r.resize(std::min(points, BlockSize));
+        }
+        std::vector<T> res(points);
+        // The points are processed in blocks such that all registers stay in cache.
+        for (std::size_t offset = 0; offset < points; offset += BlockSize) {
+            std::size_t n = std::min(points - offset, BlockSize);
+            auto column = [&](const Operand& o) -> std::pair<const T*, std::size_t> {
+                switch (o.source) {
+                    case Source::Value:
+                        return {values[o.index].data() + offset, 1};
+                    case Source::Constant:
+                        return {&mConstants[o.index], 0};
+                    default:
+                        return {registers[o.index].data(), 1};
+                }
+            };
+            for (const auto& i : mProgram) {
+                T* out = registers[i.target].data();
+                auto lhs = column(i.lhs);
+                auto rhs = column(i.rhs);
+                switch (i.op) {
+                    case Operation::Add:
+                        detail::EvaluationKernel<T>::add(out, lhs.first, lhs.second, rhs.first, rhs.second, n);
+                        break;
+                    case Operation::Mul:
+                        detail::EvaluationKernel<T>::mul(out, lhs.first, lhs.second, rhs.first, rhs.second, n);
+                        break;
+                    case Operation::Pow:
+                        detail::EvaluationKernel<T>::pow(out, lhs.first, lhs.second, i.exponent, n);
+                        break;
+                }
+            }
+            auto r = column(mResult);
+            for (std::size_t j = 0; j < n; ++j) {
+                res[offset + j] = r.first[j * r.second];
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Evaluates the polynomial at multiple points.
+     * @param values Values of the variables, ordered like variables(), all of the same length.
+     * @param points Number of points, only relevant if there are no variables.
+     * @return Values of the polynomial at all points.
+     */
+    std::vector<T> evaluateBatch(const std::vector<std::vector<T>>& values, std::size_t points = 1) const {
+        std::vector<std::vector<T>> registers;
+        return evaluateBatch(values, registers, points);
+    }
+};
+
+}  // namespace carl
@@ -0,0 +1,131 @@
+/**
+ * @file KroneckerSubstitution.cpp
+ */
+
+#include "KroneckerSubstitution.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace carl {
+namespace {
+constexpr std::size_t LimbBits = GMP_NUMB_BITS;
+
+/**
+ * Writes the absolute value of c to the given bit offset of limbs.
+ * The bits that are written to must be zero and lie within limbs.
+ */
+void pack(mp_limb_t* limbs, std::size_t offset, const mpz_class& c) {
+    std::size_t word = offset / LimbBits;
+    std::size_t shift = offset % LimbBits;
+    std::size_t size = mpz_size(c.get_mpz_t());
+    const mp_limb_t* src = mpz_limbs_read(c.get_mpz_t());
+    for (std::size_t i = 0; i < size; ++i) {
+        limbs[word + i] |= src[i] << shift;
+        if (shift > 0) {
+            limbs[word + i + 1] |= src[i] >> (LimbBits - shift);
+        }
+    }
+}
+
+/**
+ * Evaluates the coefficients of p with the given sign at 2^bits.
+ * @return Absolute value of the result.
+ */
+mpz_class pack(const SparseIntegerPolynomial& p, std::size_t degree, std::size_t bits, int sign) {
+    mpz_class res;
+    // One additional limb for the shifted part of the highest coefficient.
+    std::size_t size = ((degree + 1) * bits) / LimbBits + 2;
+    mp_limb_t* limbs = mpz_limbs_write(res.get_mpz_t(), long(size));
+    std::fill(limbs, limbs + size, mp_limb_t(0));
+    for (const auto& [e, c] : p) {
+        if (mpz_sgn(c.get_mpz_t()) == sign) {
+            pack(limbs, e * bits, c);
+        }
+    }
+    mpz_limbs_finish(res.get_mpz_t(), long(size));
+    return res;
+}
+
+/**
+ * Evaluates p at 2^bits.
+ */
+mpz_class pack(const SparseIntegerPolynomial& p, std::size_t degree, std::size_t bits) {
+    mpz_class res = pack(p, degree, bits, 1);
+    res -= pack(p, degree, bits, -1);
+    return res;
+}
+
+/**
+ * Reads the given number of bits at the given bit offset of limbs into digit.
+ */
+void extract(const mp_limb_t* limbs, std::size_t size, std::size_t offset, std::size_t bits, mpz_class& digit) {
+    std::size_t word = offset / LimbBits;
+    std::size_t shift = offset % LimbBits;
+    std::size_t digitSize = (bits + LimbBits - 1) / LimbBits;
+    mp_limb_t* dst = mpz_limbs_write(digit.get_mpz_t(), long(digitSize));
+    for (std::size_t i = 0; i < digitSize; ++i) {
+        mp_limb_t low = (word + i < size) ? limbs[word + i] >> shift : 0;
+        mp_limb_t high = (shift > 0 && word + i + 1 < size) ? limbs[word + i + 1] << (LimbBits - shift) : 0;
+        dst[i] = low | high;
+    }
+    if (bits % LimbBits != 0) {
+        dst[digitSize - 1] &= (mp_limb_t(1) << (bits % LimbBits)) - 1;
+    }
+    mpz_limbs_finish(digit.get_mpz_t(), long(digitSize));
+}
+
+std::size_t maxBits(const SparseIntegerPolynomial& p) {
+    std::size_t res = 0;
+    for (const auto& t : p) {
+        res = std::max(res, bitsize(t.second));
+    }
+    return res;
+}
+std::size_t maxExponent(const SparseIntegerPolynomial& p) {
+    std::size_t res = 0;
+    for (const auto& t : p) {
+        res = std::max(res, t.first);
+    }
+    return res;
+}
+}  // namespace
+
+SparseIntegerPolynomial kroneckerMultiply(const SparseIntegerPolynomial& lhs, const SparseIntegerPolynomial& rhs) {
+    if (lhs.empty() || rhs.empty())
+        return {};
+    // Every coefficient of the product is a sum of at most min(|lhs|, |rhs|) products, one more bit holds the sign.
+    std::size_t bits = maxBits(lhs) + maxBits(rhs) + bitsize(mpz_class(std::min(lhs.size(), rhs.size()))) + 1;
+    std::size_t degree = maxExponent(lhs) + maxExponent(rhs);
+    mpz_class product = pack(lhs, maxExponent(lhs), bits) * pack(rhs, maxExponent(rhs), bits);
+
+    // The product is the sum of c_i * 2^(bits*i) with |c_i| < 2^(bits-1). The coefficients are read as balanced digits, i.e. a digit of at
+    // least 2^(bits-1) is negative and causes a carry to the next digit.
+    int sign = mpz_sgn(product.get_mpz_t());
+    const mp_limb_t* limbs = mpz_limbs_read(product.get_mpz_t());
+    std::size_t size = mpz_size(product.get_mpz_t());
+    mpz_class half;
+    mpz_class base;
+    mpz_setbit(half.get_mpz_t(), bits - 1);
+    mpz_setbit(base.get_mpz_t(), bits);
+    SparseIntegerPolynomial res;
+    mpz_class digit;
+    bool carry = false;
+    for (std::size_t i = 0; i <= degree; ++i) {
+        extract(limbs, size, i * bits, bits, digit);
+        if (carry) {
+            ++digit;
+        }
+        carry = digit >= half;
+        if (carry) {
+            digit -= base;
+        }
+        if (!carl::isZero(digit)) {
+            res.emplace_back(i, sign < 0 ? mpz_class(-digit) : digit);
+        }
+    }
+    assert(!carry);
+    return res;
+}
+
+}  // namespace carl
@@ -0,0 +1,31 @@
+/**
+ * @file KroneckerSubstitution.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/// A univariate integer polynomial given by pairs of exponents and nonzero coefficients.
+using SparseIntegerPolynomial = std::vector<std::pair<std::size_t, mpz_class>>;
+
+/**
+ * Multiplies two univariate integer polynomials by Kronecker substitution.
+ * Both polynomials are evaluated at a power of two that is large enough to separate the coefficients of the product. These two integers
+ * are multiplied by a single call to mpz_mul, which uses the asymptotically fast algorithms of GMP, and the coefficients of the product are
+ * read off the binary representation of the result.
+ * The cost depends on the degree of the product rather than the number of terms, hence this only pays off for dense polynomials.
+ * @param lhs First factor.
+ * @param rhs Second factor.
+ * @return Product, ordered by increasing exponents.
+ */
+SparseIntegerPolynomial kroneckerMultiply(const SparseIntegerPolynomial& lhs, const SparseIntegerPolynomial& rhs);
+
+}  // namespace carl
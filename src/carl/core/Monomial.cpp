@@ -8,7 +8,41 @@
 #include "MonomialPool.h"
 #include "logging.h"
 
+#include <bit>
+
 namespace carl {
+namespace {
+/**
+ * Converts packed exponents to the content of a monomial.
+ * The variables are taken from the contents of lhs and rhs, every variable of the packed exponents must occur in one of them.
+ * @param packed Packed exponents.
+ * @param lhs Content of the first monomial.
+ * @param lhsPacked Packed exponents of the first monomial.
+ * @param rhs Content of the second monomial.
+ * @param rhsPacked Packed exponents of the second monomial.
+ * @param tdeg Set to the total degree of the result.
+ * @return Content.
+ */
+Monomial::Content unpack(const PackedExponents& packed, const Monomial::Content& lhs, const PackedExponents& lhsPacked, const Monomial::Content& rhs,
+                         const PackedExponents& rhsPacked, uint& tdeg) {
+    Monomial::Content res;
+    res.reserve(std::size_t(std::popcount(packed.variables())));
+    tdeg = 0;
+    for (unsigned vars = packed.variables(); vars != 0; vars &= vars - 1) {
+        std::size_t slot = std::size_t(std::countr_zero(vars));
+        unsigned smaller = (1u << slot) - 1;
+        // The position of a variable in the content is the number of smaller variables.
+        if ((lhsPacked.variables() >> slot) & 1u) {
+            res.emplace_back(lhs[std::size_t(std::popcount(lhsPacked.variables() & smaller))].first, packed.exponent(slot));
+        } else {
+            res.emplace_back(rhs[std::size_t(std::popcount(rhsPacked.variables() & smaller))].first, packed.exponent(slot));
+        }
+        tdeg += res.back().second;
+    }
+    return res;
+}
+}  // namespace
+
 Monomial::~Monomial() {
 #ifdef CARL_PRUNE_MONOMIAL_POOL
     MonomialPool::getInstance().free(this);
@@ -66,11 +100,15 @@ bool Monomial::divide(const Monomial::Arg& m, Monomial::Arg& res) const {
         res = carl::createMonomial(Content(mExponents), mTotalDegree);
         return true;
     }
-    if (m->mTotalDegree > mTotalDegree || m->mExponents.size() > mExponents.size()) {
+    if (m->mTotalDegree > mTotalDegree || m->mExponents.size() > mExponents.size() || (m->mSignature & ~mSignature) != 0) {
         // Division will fail.
         CARL_LOG_TRACE("carl.core.monomial", "Result: nullptr");
         return false;
     }
+    if (mPacked.packed() && !(m->mPacked.packed() && PackedExponents::divisible(mPacked, m->mPacked))) {
+        CARL_LOG_TRACE("carl.core.monomial", "Result: nullptr");
+        return false;
+    }
     Content newExps;
 
     // Linear, as we expect small monomials.
@@ -226,6 +264,21 @@ Monomial::Arg Monomial::gcd(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
     assert(lhs->isConsistent());
     assert(rhs->isConsistent());
 
+    if (lhs->mPacked.packed() && rhs->mPacked.packed()) {
+        PackedExponents packed = PackedExponents::gcd(lhs->mPacked, rhs->mPacked);
+        if (!packed.packed())
+            return nullptr;
+        if (packed == lhs->mPacked)
+            return lhs;
+        if (packed == rhs->mPacked)
+            return rhs;
+        uint tdeg = 0;
+        Content newExps = unpack(packed, lhs->mExponents, lhs->mPacked, rhs->mExponents, rhs->mPacked, tdeg);
+        std::shared_ptr<const Monomial> result = createMonomial(std::move(newExps), tdeg);
+        CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
+        return result;
+    }
+
     Content newExps;
     uint expsum = 0;
     // Linear, as we expect small monomials.
@@ -267,6 +320,19 @@ Monomial::Arg Monomial::lcm(const std::shared_ptr<const Monomial>& lhs, const st
     assert(lhs->isConsistent());
     assert(rhs->isConsistent());
 
+    if (lhs->mPacked.packed() && rhs->mPacked.packed()) {
+        PackedExponents packed = PackedExponents::lcm(lhs->mPacked, rhs->mPacked);
+        if (packed == lhs->mPacked)
+            return lhs;
+        if (packed == rhs->mPacked)
+            return rhs;
+        uint tdeg = 0;
+        Content newExps = unpack(packed, lhs->mExponents, lhs->mPacked, rhs->mExponents, rhs->mPacked, tdeg);
+        std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create(std::move(newExps), tdeg);
+        CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
+        return result;
+    }
+
     Content newExps;
     uint expsum = lhs->tdeg() + rhs->tdeg();
     // Linear, as we expect small monomials.
@@ -343,6 +409,8 @@ CompareResult Monomial::lexicalCompare(const Monomial& lhs, const Monomial& rhs)
     assert((lhs.id() != 0) && (rhs.id() != 0));
     if (lhs.id() == rhs.id())
         return CompareResult::EQUAL;
+    if (lhs.mPacked.packed() && rhs.mPacked.packed())
+        return PackedExponents::lexicalCompare(lhs.mPacked, rhs.mPacked);
     auto lhsit = lhs.mExponents.begin();
     auto rhsit = rhs.mExponents.begin();
     auto lhsend = lhs.mExponents.end();
@@ -377,6 +445,10 @@ Monomial::Arg operator*(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
     assert(lhs->tdeg() > 0);
     assert(lhs->isConsistent());
     assert(rhs->isConsistent());
+    MonomialPool& pool = MonomialPool::getInstance();
+    if (Monomial::Arg cached = pool.cachedProduct(lhs, rhs)) {
+        return cached;
+    }
     Monomial::Content newExps;
     newExps.reserve(lhs->exponents().size() + rhs->exponents().size());
 
@@ -406,7 +478,8 @@ Monomial::Arg operator*(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
         newExps.insert(newExps.end(), itleft, lhs->end());
     else if (itright != rhs->end())
         newExps.insert(newExps.end(), itright, rhs->end());
-    Monomial::Arg result = createMonomial(std::move(newExps), lhs->tdeg() + rhs->tdeg());
+    Monomial::Arg result = pool.create(std::move(newExps), lhs->tdeg() + rhs->tdeg());
+    pool.cacheProduct(lhs, rhs, result);
     CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
     return result;
 }
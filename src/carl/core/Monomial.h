@@ -9,11 +9,13 @@
 
 #include "../numbers/numbers.h"
 #include "CompareResult.h"
+#include "PackedExponents.h"
 #include "Variable.h"
 #include "VariablePool.h"
 #include "logging.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <list>
 #include <set>
 #include <sstream>
@@ -33,6 +35,9 @@ inline bool operator==(const std::pair<Variable, uint>& p, Variable v) {
     return p.first == v;
 }
 
+template<typename T, typename Storage>
+class SlabAllocator;
+
 /**
  * The general-purpose monomials. Notice that we aim to keep this object as small as possbible,
  * while also limiting the use of expensive language features such as RTTI, exceptions and even
@@ -51,6 +56,9 @@ inline bool operator==(const std::pair<Variable, uint>& p, Variable v) {
  */
 class Monomial final {
     friend class MonomialPool;
+    /// Monomials of a pool that does not prune are created by std::allocate_shared with a SlabAllocator.
+    template<typename T, typename Storage>
+    friend class SlabAllocator;
 
    public:
     using Arg = std::shared_ptr<const Monomial>;
@@ -66,6 +74,10 @@ class Monomial final {
     mutable std::size_t mId = 0;
     /// Cached hash.
     mutable std::size_t mHash = 0;
+    /// Packed copy of mExponents, if all variables and exponents are small.
+    PackedExponents mPacked;
+    /// Bit i is set if a variable whose id is i modulo 64 occurs. Allows to reject most divisors without looking at the exponents.
+    std::uint64_t mSignature = 0;
 
     using exponents_it = Content::iterator;
     using exponents_cIt = Content::const_iterator;
@@ -81,6 +93,16 @@ class Monomial final {
     void calcHash() {
         mHash = Monomial::hashContent(mExponents);
     }
+    /**
+     * Calculates the packed exponents and the variable signature and stores them to mPacked and mSignature.
+     */
+    void calcPacked() {
+        mPacked = PackedExponents::pack(mExponents);
+        mSignature = 0;
+        for (const auto& ve : mExponents) {
+            mSignature |= std::uint64_t(1) << (ve.first.id() % 64);
+        }
+    }
 
     /**
      * Generate a monomial from a variable and an exponent.
@@ -89,6 +111,7 @@ class Monomial final {
      */
     explicit Monomial(Variable v, uint e = 1) : mExponents(1, std::make_pair(v, e)), mTotalDegree(e) {
         calcHash();
+        calcPacked();
         assert(isConsistent());
     }
 
@@ -101,6 +124,7 @@ class Monomial final {
      */
     Monomial(Content&& exponents, uint totalDegree) : mExponents(std::move(exponents)), mTotalDegree(totalDegree) {
         calcHash();
+        calcPacked();
         assert(isConsistent());
     }
 
@@ -113,6 +137,7 @@ class Monomial final {
                   [](const std::pair<Variable, uint>& p1, const std::pair<Variable, uint>& p2) { return p1.first < p2.first; });
         for (const auto& e : mExponents) mTotalDegree += e.second;
         calcHash();
+        calcPacked();
         assert(isConsistent());
     }
 
@@ -125,6 +150,7 @@ class Monomial final {
             mTotalDegree += ve.second;
         }
         calcHash();
+        calcPacked();
         assert(isConsistent());
     }
 
@@ -132,9 +158,11 @@ class Monomial final {
         for (auto const& ve : mExponents) {
             mTotalDegree += ve.second;
         }
+        calcPacked();
         assert(isConsistent());
     }
     explicit Monomial(std::size_t hash, Content exponents, uint totalDegree) : mExponents(std::move(exponents)), mTotalDegree(totalDegree), mHash(hash) {
+        calcPacked();
         assert(isConsistent());
     }
 
@@ -196,6 +224,13 @@ class Monomial final {
         return mExponents;
     }
 
+    /**
+     * @return Packed exponents, empty if this monomial can not be packed.
+     */
+    const PackedExponents& packedExponents() const {
+        return mPacked;
+    }
+
     /**
      * Checks whether the monomial is a constant.
      * @return If monomial is constant.
@@ -333,6 +368,12 @@ class Monomial final {
         assert(isConsistent());
         if (m->mTotalDegree > mTotalDegree)
             return false;
+        if ((m->mSignature & ~mSignature) != 0)
+            return false;
+        if (mPacked.packed()) {
+            // If m can not be packed, it contains a variable or an exponent that is not present in this monomial.
+            return m->mPacked.packed() && PackedExponents::divisible(mPacked, m->mPacked);
+        }
         if (m->nrVariables() > nrVariables())
             return false;
         // Linear, as we expect small monomials.
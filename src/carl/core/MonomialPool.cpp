@@ -7,68 +7,288 @@
 
 #include "../io/streamingOperators.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace carl {
+namespace {
+/**
+ * Direct-mapped cache of recently created monomials, local to every thread.
+ * As most monomials are recreated while they still exist, this allows to retrieve them without locking the pool.
+ */
+struct CreationCache {
+    struct Entry {
+        std::size_t hash = 0;
+        std::weak_ptr<const Monomial> monomial;
+    };
+    std::vector<Entry> entries;
+    std::size_t generation = std::numeric_limits<std::size_t>::max();
+    MonomialPool::CreationCacheStatistics statistics;
+
+    static CreationCache& get() {
+        static thread_local CreationCache cache;
+        return cache;
+    }
+    Entry& entry(std::size_t hash) {
+        return entries[(hash ^ (hash >> 16)) & (entries.size() - 1)];
+    }
+};
+
+/**
+ * Direct-mapped cache of products of monomials, local to every thread.
+ * Entries are indexed by the ids of the factors. As ids are reused once a monomial is destructed, the factors are additionally identified by weak
+ * pointers to them.
+ */
+struct ProductCache {
+    struct Entry {
+        std::size_t lhsID = 0;
+        std::size_t rhsID = 0;
+        std::weak_ptr<const Monomial> lhs;
+        std::weak_ptr<const Monomial> rhs;
+        std::weak_ptr<const Monomial> product;
+    };
+    std::vector<Entry> entries;
+    std::size_t generation = std::numeric_limits<std::size_t>::max();
+    MonomialPool::ProductCacheStatistics statistics;
+
+    static ProductCache& get() {
+        static thread_local ProductCache cache;
+        return cache;
+    }
+    static bool refersTo(const std::weak_ptr<const Monomial>& ptr, const Monomial::Arg& m) {
+        return !ptr.owner_before(m) && !m.owner_before(ptr);
+    }
+    Entry& entry(std::size_t lhsID, std::size_t rhsID) {
+        std::uint64_t hash = (static_cast<std::uint64_t>(lhsID) * 0x9E3779B97F4A7C15ull) ^ (static_cast<std::uint64_t>(rhsID) * 0xC2B2AE3D27D4EB4Full);
+        return entries[static_cast<std::size_t>(hash ^ (hash >> 32)) & (entries.size() - 1)];
+    }
+};
+}  // namespace
+
+MonomialPool::CreationCacheStatistics MonomialPool::creationCacheStatistics() {
+    return CreationCache::get().statistics;
+}
+
+void MonomialPool::resetCreationCacheStatistics() {
+    CreationCache::get().statistics = CreationCacheStatistics();
+}
+
+MonomialPool::ProductCacheStatistics MonomialPool::productCacheStatistics() {
+    return ProductCache::get().statistics;
+}
+
+void MonomialPool::resetProductCacheStatistics() {
+    ProductCache::get().statistics = ProductCacheStatistics();
+}
+
+Monomial::Arg MonomialPool::cachedProduct(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
+    ProductCache& cache = ProductCache::get();
+    if (cache.generation != mProductCacheGeneration.load(std::memory_order_relaxed)) {
+        cache.generation = mProductCacheGeneration.load(std::memory_order_relaxed);
+        cache.entries.clear();
+        cache.entries.resize(mProductCacheSize.load(std::memory_order_relaxed));
+    }
+    if (cache.entries.empty() || lhs->id() == 0 || rhs->id() == 0) {
+        return nullptr;
+    }
+    // The product is commutative, hence we order the factors by their ids.
+    const Monomial::Arg& first = (lhs->id() <= rhs->id()) ? lhs : rhs;
+    const Monomial::Arg& second = (lhs->id() <= rhs->id()) ? rhs : lhs;
+    const auto& entry = cache.entry(first->id(), second->id());
+    if (entry.lhsID == first->id() && entry.rhsID == second->id() && ProductCache::refersTo(entry.lhs, first) && ProductCache::refersTo(entry.rhs, second)) {
+        std::size_t token = beginLookup();
+        Monomial::Arg res = entry.product.lock();
+        if (res && validLookup(token)) {
+            ++cache.statistics.hits;
+            return res;
+        }
+    }
+    ++cache.statistics.misses;
+    return nullptr;
+}
+
+void MonomialPool::cacheProduct(const Monomial::Arg& lhs, const Monomial::Arg& rhs, const Monomial::Arg& product) {
+    ProductCache& cache = ProductCache::get();
+    if (cache.generation != mProductCacheGeneration.load(std::memory_order_relaxed) || cache.entries.empty() || lhs->id() == 0 || rhs->id() == 0) {
+        return;
+    }
+    const Monomial::Arg& first = (lhs->id() <= rhs->id()) ? lhs : rhs;
+    const Monomial::Arg& second = (lhs->id() <= rhs->id()) ? rhs : lhs;
+    auto& entry = cache.entry(first->id(), second->id());
+    entry.lhsID = first->id();
+    entry.rhsID = second->id();
+    entry.lhs = first;
+    entry.rhs = second;
+    entry.product = product;
+}
+
 #ifdef CARL_PRUNE_MONOMIAL_POOL
 Monomial::Arg MonomialPool::add(MonomialPool::PoolEntry&& pe, exponent totalDegree) {
-    MONOMIAL_POOL_LOCK_GUARD
-    auto iter = mPool.insert(std::move(pe));
+    Shard& shard = shardOf(pe.hash);
+    auto lock = lockShard(shard);
+    auto iter = shard.pool.insert(std::move(pe));
     Monomial::Arg res;
-    if (iter.second) {
-        if (iter.first->monomial.expired()) {
-            if (totalDegree == 0) {
-                res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
-                iter.first->monomial = res;
-            } else {
-                res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content, totalDegree));
-                iter.first->monomial = res;
-            }
-        } else {
-            res = iter.first->monomial.lock();
+    if (!iter.second) {
+        res = iter.first->monomial.lock();
+        if (res) {
+            ++mHits;
+            return res;
         }
-        res->mId = mIDs.get();
+        // The monomial of this entry is currently being destructed, we take over the entry and release its id.
+        freeID(shard, iter.first->id);
     } else {
-        res = iter.first->monomial.lock();
+        inserted();
     }
+    ++mCreated;
+    if (totalDegree == 0) {
+        res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
+    } else {
+        res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content, totalDegree));
+    }
+    iter.first->monomial = res;
+    res->mId = getID(shard);
+    iter.first->id = res->mId;
     return res;
 }
 
 Monomial::Arg MonomialPool::add(const Monomial::Arg& _monomial) {
     assert(_monomial->id() == 0);
     PoolEntry pe(_monomial->hash(), _monomial->exponents(), _monomial);
-    MONOMIAL_POOL_LOCK_GUARD
-    auto iter = mPool.insert(pe);
-    if (iter.second) {
-        _monomial->mId = mIDs.get();
-        return _monomial;
+    Shard& shard = shardOf(pe.hash);
+    auto lock = lockShard(shard);
+    auto iter = shard.pool.insert(pe);
+    if (!iter.second) {
+        Monomial::Arg res = iter.first->monomial.lock();
+        if (res) {
+            ++mHits;
+            return res;
+        }
+        // The monomial of this entry is currently being destructed, we take over the entry and release its id.
+        freeID(shard, iter.first->id);
+        iter.first->monomial = _monomial;
     } else {
-        assert(_monomial == iter.first->monomial.lock());
-        return iter.first->monomial.lock();
+        inserted();
     }
+    ++mCreated;
+    _monomial->mId = getID(shard);
+    iter.first->id = _monomial->mId;
+    return _monomial;
 }
 #else
 Monomial::Arg MonomialPool::add(MonomialPool::PoolEntry&& pe, exponent totalDegree) {
-    MONOMIAL_POOL_LOCK_GUARD
-    auto iter = mPool.insert(pe);
+    Shard& shard = shardOf(pe.hash);
+    auto lock = lockShard(shard);
+    auto iter = shard.pool.insert(std::move(pe));
     if (iter.second) {
-        if (iter.first->monomial == nullptr) {
-            if (totalDegree == 0) {
-                iter.first->monomial.reset(new Monomial(iter.first->hash, iter.first->content));
-            } else {
-                iter.first->monomial.reset(new Monomial(iter.first->hash, iter.first->content, totalDegree));
-            }
+        SlabAllocator<Monomial, MonomialSlot> allocator(shard.slab);
+        if (totalDegree == 0) {
+            iter.first->monomial = std::allocate_shared<Monomial>(allocator, iter.first->hash, iter.first->content);
+        } else {
+            iter.first->monomial = std::allocate_shared<Monomial>(allocator, iter.first->hash, iter.first->content, totalDegree);
         }
-        iter.first->monomial->mId = mIDs.get();
+        iter.first->monomial->mId = getID(shard);
+        inserted();
+        ++mCreated;
+    } else {
+        ++mHits;
     }
     return iter.first->monomial;
 }
 
 Monomial::Arg MonomialPool::add(const Monomial::Arg& _monomial) {
     assert(_monomial->id() == 0);
-    return MonomialPool::add(std::move(PoolEntry(_monomial->hash(), _monomial->exponents(), _monomial)));
+    PoolEntry pe(_monomial->hash(), _monomial->exponents(), _monomial);
+    Shard& shard = shardOf(pe.hash);
+    auto lock = lockShard(shard);
+    auto iter = shard.pool.insert(std::move(pe));
+    if (iter.second) {
+        _monomial->mId = getID(shard);
+        inserted();
+        ++mCreated;
+    } else {
+        ++mHits;
+    }
+    return iter.first->monomial;
+}
+
+std::size_t MonomialPool::collect() {
+#ifdef CARL_THREAD_SAFE
+    std::lock_guard<std::mutex> collectLock(mCollectMutex);
+#endif
+    ++mEpoch;
+    ++mCreationCacheGeneration;
+    ++mProductCacheGeneration;
+    // Pairs with the fence in validLookup().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::size_t res = 0;
+    for (auto& shard : mShards) {
+        auto lock = lockShard(shard);
+        for (auto it = shard.pool.begin(); it != shard.pool.end();) {
+            if (it->monomial.use_count() == 1) {
+                freeID(shard, it->monomial->id());
+                it = shard.pool.erase(it);
+                ++res;
+            } else {
+                ++it;
+            }
+        }
+    }
+    mEpoch.fetch_add(1, std::memory_order_release);
+    removed(res);
+    CARL_LOG_DEBUG("carl.pool", "Reclaimed " << res << " monomials");
+    return res;
 }
 #endif
 Monomial::Arg MonomialPool::add(Monomial::Content&& c, exponent totalDegree) {
-    return MonomialPool::add(PoolEntry(std::move(c)), totalDegree);
+    std::size_t hash = Monomial::hashContent(c);
+    CreationCache& cache = CreationCache::get();
+    if (cache.generation != mCreationCacheGeneration.load(std::memory_order_relaxed)) {
+        cache.generation = mCreationCacheGeneration.load(std::memory_order_relaxed);
+        cache.entries.clear();
+        cache.entries.resize(mCreationCacheSize.load(std::memory_order_relaxed));
+    }
+    if (cache.entries.empty()) {
+        return MonomialPool::add(PoolEntry(hash, std::move(c)), totalDegree);
+    }
+    auto& entry = cache.entry(hash);
+    if (entry.hash == hash) {
+        std::size_t token = beginLookup();
+        Monomial::Arg res = entry.monomial.lock();
+        if (res && res->exponents() == c && validLookup(token)) {
+            ++cache.statistics.hits;
+            return res;
+        }
+    }
+    ++cache.statistics.misses;
+    Monomial::Arg res = MonomialPool::add(PoolEntry(hash, std::move(c)), totalDegree);
+    entry.hash = hash;
+    entry.monomial = res;
+    return res;
+}
+
+MonomialPool::Statistics MonomialPool::statistics() const {
+    Statistics res;
+    for (const auto& shard : mShards) {
+        auto lock = lockShard(shard);
+        res.live += shard.pool.size();
+        res.buckets += shard.pool.bucket_count();
+        for (std::size_t b = 0; b < shard.pool.bucket_count(); ++b) {
+            res.maxBucketSize = std::max(res.maxBucketSize, shard.pool.bucket_size(b));
+        }
+        for (const auto& entry : shard.pool) {
+            res.contentBytes += entry.content.capacity() * sizeof(Monomial::Content::value_type);
+        }
+    }
+    res.peak = std::max(mPeak.load(), res.live);
+    res.largestID = largestID();
+    res.created = mCreated;
+    res.hits = mHits;
+    res.freed = mFreed;
+    res.contendedLocks = mContendedLocks;
+    res.lockWaitTime = std::chrono::nanoseconds(mLockWaitTime.load());
+    return res;
 }
 
 Monomial::Arg MonomialPool::create() {
@@ -76,7 +296,7 @@ Monomial::Arg MonomialPool::create() {
 }
 
 Monomial::Arg MonomialPool::create(Variable _var, exponent _exp) {
-    return add(Monomial::Arg(new Monomial(_var, _exp)));
+    return add(Monomial::Content(1, std::make_pair(_var, _exp)), _exp);
 }
 
 Monomial::Arg MonomialPool::create(std::vector<std::pair<Variable, exponent>>&& _exponents, exponent _totalDegree) {
@@ -84,7 +304,10 @@ Monomial::Arg MonomialPool::create(std::vector<std::pair<Variable, exponent>>&&
 }
 
 Monomial::Arg MonomialPool::create(const std::initializer_list<std::pair<Variable, exponent>>& _exponents) {
-    return add(Monomial::Arg(new Monomial(_exponents)));
+    // Sorting the content first allows to create the monomial in the pool, instead of allocating it before it is looked up.
+    Monomial::Content content(_exponents);
+    std::sort(content.begin(), content.end(), [](const auto& p1, const auto& p2) { return p1.first < p2.first; });
+    return add(std::move(content));
 }
 
 Monomial::Arg MonomialPool::create(std::vector<std::pair<Variable, exponent>>&& _exponents) {
@@ -9,10 +9,16 @@
 #include "../util/Common.h"
 #include "../util/IDPool.h"
 #include "../util/Singleton.h"
+#include "../util/Slab.h"
 #include "Monomial.h"
 #include "config.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 namespace carl {
@@ -25,14 +31,17 @@ class __attribute__((visibility("default"))) MonomialPool : public Singleton<Mon
     struct PoolEntry {
         Monomial::Content content;
         std::size_t hash;
+#ifdef CARL_PRUNE_MONOMIAL_POOL
         mutable std::weak_ptr<const Monomial> monomial;
+        /// Id of the monomial, which identifies the entry after the monomial expired.
+        mutable std::size_t id = 0;
+#else
+        /// The pool owns its monomials until they are reclaimed by collect().
+        mutable Monomial::Arg monomial;
+#endif
         PoolEntry(std::size_t h, Monomial::Content c, const Monomial::Arg& m) : content(std::move(c)), hash(h), monomial(m) {}
-        PoolEntry(std::size_t h, Monomial::Content c) : content(std::move(c)), hash(h) {
-            assert(monomial.expired());
-        }
-        explicit PoolEntry(Monomial::Content c) : content(std::move(c)), hash(Monomial::hashContent(content)), monomial() {
-            assert(monomial.expired());
-        }
+        PoolEntry(std::size_t h, Monomial::Content c) : content(std::move(c)), hash(h) {}
+        explicit PoolEntry(Monomial::Content c) : content(std::move(c)), hash(Monomial::hashContent(content)), monomial() {}
     };
     struct hash {
         std::size_t operator()(const PoolEntry& p) const {
@@ -43,41 +52,199 @@ class __attribute__((visibility("default"))) MonomialPool : public Singleton<Mon
         bool operator()(const PoolEntry& p1, const PoolEntry& p2) const {
             if (p1.hash != p2.hash)
                 return false;
+#ifdef CARL_PRUNE_MONOMIAL_POOL
             if (p1.monomial.lock() && p2.monomial.lock()) {
                 return p1.monomial.lock() == p2.monomial.lock();
             }
+#else
+            if (p1.monomial && p2.monomial) {
+                return p1.monomial == p2.monomial;
+            }
+#endif
             return p1.content == p2.content;
         }
     };
 
    private:
+#ifdef CARL_SHARDED_MONOMIAL_POOL
+    /// Number of independently locked partitions of the pool.
+    static constexpr std::size_t NumShards = 16;
+#else
+    static constexpr std::size_t NumShards = 1;
+#endif
+#ifndef CARL_PRUNE_MONOMIAL_POOL
+    /// Storage for a monomial that is created by std::allocate_shared, i.e. the monomial together with its control block.
+    struct alignas(std::max_align_t) MonomialSlot {
+        std::byte data[sizeof(Monomial) + 4 * sizeof(void*)];
+    };
+#endif
+    /**
+     * A partition of the pool.
+     * Every monomial is stored in the shard selected by its hash, hence operations on monomials with different hashes usually do not contend.
+     * The ids of a shard are the local ids of its id allocator, interleaved with the ids of the other shards.
+     */
+    struct Shard {
+        /// id allocator
+        IDPool ids;
+        /// The monomials of this shard.
+        std::unordered_set<PoolEntry, MonomialPool::hash, MonomialPool::equal> pool;
+        /// Mutex to avoid multiple access to this shard
+        mutable std::recursive_mutex mutex;
+#ifndef CARL_PRUNE_MONOMIAL_POOL
+        /// Storage of the monomials of this shard and their control blocks. Released by the shard, as the monomials may outlive the pool.
+        Slab<MonomialSlot>* slab = new Slab<MonomialSlot>();
+
+        Shard() = default;
+        Shard(const Shard&) = delete;
+        Shard& operator=(const Shard&) = delete;
+        ~Shard() {
+            slab->release();
+        }
+#endif
+    };
     // Members:
-    /// id allocator
-    IDPool mIDs;
-    // size_t mIdAllocator;
-    /// The pool.
-    std::unordered_set<PoolEntry, MonomialPool::hash, MonomialPool::equal> mPool;
-    /// Mutex to avoid multiple access to the pool
-    mutable std::recursive_mutex mMutex;
+    /// The shards of the pool.
+    std::array<Shard, NumShards> mShards;
+    /// The largest id that was ever handed out.
+    std::atomic<std::size_t> mLargestID = 0;
+    /// Number of monomials in the pool.
+    std::atomic<std::size_t> mLive = 0;
+    /// Largest number of monomials in the pool since the last reset of the statistics.
+    std::atomic<std::size_t> mPeak = 0;
+    /// Number of monomials that were constructed by the pool.
+    std::atomic<std::size_t> mCreated = 0;
+    /// Number of requests that were answered with an existing monomial.
+    std::atomic<std::size_t> mHits = 0;
+    /// Number of monomials that were removed from the pool.
+    std::atomic<std::size_t> mFreed = 0;
+    /// Number of times a thread had to wait for the lock of a shard.
+    mutable std::atomic<std::size_t> mContendedLocks = 0;
+    /// Overall time threads waited for the locks of shards, in nanoseconds.
+    mutable std::atomic<std::size_t> mLockWaitTime = 0;
+    /// Number of entries of the thread-local creation caches.
+    std::atomic<std::size_t> mCreationCacheSize = 256;
+    /// Incremented whenever the thread-local creation caches become invalid.
+    std::atomic<std::size_t> mCreationCacheGeneration = 0;
+    /// Number of entries of the thread-local product caches, zero if disabled.
+    std::atomic<std::size_t> mProductCacheSize = 0;
+    /// Incremented whenever the thread-local product caches become invalid.
+    std::atomic<std::size_t> mProductCacheGeneration = 0;
+#ifndef CARL_PRUNE_MONOMIAL_POOL
+    /// Incremented at the beginning and at the end of collect(), hence odd while monomials are reclaimed.
+    std::atomic<std::size_t> mEpoch = 0;
+    /// Mutex to avoid concurrent calls of collect().
+    std::mutex mCollectMutex;
+#endif
 
+    /**
+     * Locks the given shard and records the time spent waiting for it.
+     * The clock is only read if the lock could not be acquired immediately, hence uncontended locking is cheap. Without CARL_THREAD_SAFE,
+     * nothing is locked.
+     * @param shard Shard.
+     * @return Lock of the shard.
+     */
+    std::unique_lock<std::recursive_mutex> lockShard(const Shard& shard) const {
 #ifdef CARL_THREAD_SAFE
-#define MONOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mMutex);
-#define MONOMIAL_POOL_LOCK mMutex.lock();
-#define MONOMIAL_POOL_UNLOCK mMutex.unlock();
+        std::unique_lock<std::recursive_mutex> lock(shard.mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            auto start = std::chrono::steady_clock::now();
+            lock.lock();
+            mLockWaitTime += std::size_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+            ++mContendedLocks;
+        }
+        return lock;
+#else
+        return std::unique_lock<std::recursive_mutex>();
+#endif
+    }
+
+    /**
+     * Starts to obtain a monomial from a weak pointer of a thread-local cache, which does not lock the pool.
+     * @return Token for validLookup().
+     */
+    std::size_t beginLookup() const {
+#ifdef CARL_PRUNE_MONOMIAL_POOL
+        return 0;
+#else
+        return mEpoch.load(std::memory_order_acquire);
+#endif
+    }
+    /**
+     * Checks if a monomial that was obtained from a weak pointer since beginLookup() may be used.
+     * Without pruning, collect() may concurrently find the reference of the pool to be the only one and drop the monomial from the pool. The
+     * monomial is then still alive, but its id may be reused, hence it must not be used.
+     * @param token Result of beginLookup().
+     * @return If the monomial is still in the pool.
+     */
+    bool validLookup([[maybe_unused]] std::size_t token) const {
+#ifdef CARL_PRUNE_MONOMIAL_POOL
+        return true;
 #else
-#define MONOMIAL_POOL_LOCK_GUARD
-#define MONOMIAL_POOL_LOCK
-#define MONOMIAL_POOL_UNLOCK
+        // Pairs with the fence in collect(): either collect() sees the reference obtained by the lookup, or the lookup sees the new epoch.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return token % 2 == 0 && mEpoch.load(std::memory_order_relaxed) == token;
 #endif
+    }
+
+    /**
+     * Records that a monomial was inserted into the pool.
+     */
+    void inserted() {
+        std::size_t live = ++mLive;
+        std::size_t peak = mPeak.load(std::memory_order_relaxed);
+        while (live > peak && !mPeak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+    /**
+     * Records that the given number of monomials were removed from the pool.
+     */
+    void removed(std::size_t count) {
+        mLive -= count;
+        mFreed += count;
+    }
+
+    static std::size_t shardIndex(std::size_t hash) {
+        // Monomial hashes are not well distributed, hence we mix them (fibonacci hashing) before selecting a shard.
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32) % NumShards;
+    }
+    Shard& shardOf(std::size_t hash) {
+        return mShards[shardIndex(hash)];
+    }
+
+    /**
+     * Allocates a new id from the given shard.
+     * @param shard Shard, must be locked by the caller.
+     * @return New id.
+     */
+    std::size_t getID(Shard& shard) {
+        std::size_t id = shard.ids.get() * NumShards + std::size_t(&shard - mShards.data());
+        std::size_t largest = mLargestID.load(std::memory_order_relaxed);
+        while (id > largest && !mLargestID.compare_exchange_weak(largest, id, std::memory_order_relaxed)) {
+        }
+        return id;
+    }
+    /**
+     * Releases an id to the given shard.
+     * @param shard Shard, must be locked by the caller.
+     * @param id Id, must have been allocated from this shard.
+     */
+    void freeID(Shard& shard, std::size_t id) {
+        assert(id % NumShards == std::size_t(&shard - mShards.data()));
+        shard.ids.free(id / NumShards);
+    }
 
    protected:
     /**
      * Constructor of the pool.
      * @param _capacity Expected necessary capacity of the pool.
      */
-    explicit MonomialPool(std::size_t _capacity = 10000) : mPool(_capacity) {
-        mIDs.get();
-        assert(mIDs.largestID() == 0);
+    explicit MonomialPool(std::size_t _capacity = 10000) {
+        for (auto& shard : mShards) {
+            shard.pool.reserve(_capacity / NumShards);
+        }
+        // Id zero is reserved for the constant monomial.
+        [[maybe_unused]] std::size_t zero = getID(mShards[0]);
+        assert(zero == 0);
         VariablePool::getInstance();
         CARL_LOG_DEBUG("carl.pool", "Monomialpool constructed");
     }
@@ -89,6 +256,59 @@ class __attribute__((visibility("default"))) MonomialPool : public Singleton<Mon
     Monomial::Arg add(MonomialPool::PoolEntry&& pe, exponent totalDegree = 0);
 
    public:
+    /**
+     * Hit and miss counters of a thread-local creation cache.
+     */
+    struct CreationCacheStatistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+    using ProductCacheStatistics = CreationCacheStatistics;
+
+    /**
+     * Statistics about the size and usage of the pool.
+     */
+    struct Statistics {
+        /// Number of monomials in the pool.
+        std::size_t live = 0;
+        /// Largest number of monomials in the pool since the last reset.
+        std::size_t peak = 0;
+        /// Number of bytes used by the contents of the monomials in the pool.
+        std::size_t contentBytes = 0;
+        /// Number of hash buckets of all shards.
+        std::size_t buckets = 0;
+        /// Number of monomials in the fullest hash bucket.
+        std::size_t maxBucketSize = 0;
+        /// Largest id that was ever handed out.
+        std::size_t largestID = 0;
+        /// Number of monomials that were constructed since the last reset.
+        std::size_t created = 0;
+        /// Number of requests answered with an existing monomial since the last reset.
+        std::size_t hits = 0;
+        /// Number of monomials that were removed since the last reset.
+        std::size_t freed = 0;
+        /// Number of times a thread had to wait for a lock since the last reset. Always zero without CARL_THREAD_SAFE.
+        std::size_t contendedLocks = 0;
+        /// Time spent waiting for locks since the last reset.
+        std::chrono::nanoseconds lockWaitTime{0};
+
+        /**
+         * @return Average number of monomials per hash bucket.
+         */
+        double loadFactor() const {
+            return (buckets == 0) ? 0.0 : double(live) / double(buckets);
+        }
+        friend std::ostream& operator<<(std::ostream& os, const Statistics& s) {
+            os << "MonomialPool statistics:" << std::endl;
+            os << "\tlive monomials: " << s.live << " (peak " << s.peak << ", largest id " << s.largestID << ")" << std::endl;
+            os << "\tcontent bytes: " << s.contentBytes << std::endl;
+            os << "\tbuckets: " << s.buckets << " (load " << s.loadFactor() << ", max bucket size " << s.maxBucketSize << ")" << std::endl;
+            os << "\tcreated: " << s.created << ", hits: " << s.hits << ", freed: " << s.freed << std::endl;
+            os << "\tcontended locks: " << s.contendedLocks << " (waited " << s.lockWaitTime.count() << "ns)" << std::endl;
+            return os;
+        }
+    };
+
     /**
      * Try to add the given monomial to the pool.
      * @param _monomial The monomial to add.
@@ -110,40 +330,150 @@ class __attribute__((visibility("default"))) MonomialPool : public Singleton<Mon
 
     Monomial::Arg create(std::vector<std::pair<Variable, exponent>>&& _exponents);
 
+#ifdef CARL_PRUNE_MONOMIAL_POOL
     void free(const Monomial* m) {
         if (m == nullptr)
             return;
         if (m->id() == 0)
             return;
-        MONOMIAL_POOL_LOCK_GUARD;
+        Shard& shard = shardOf(m->mHash);
+        auto lock = lockShard(shard);
         PoolEntry pe(m->mHash, m->mExponents);
-        auto it = mPool.find(pe);
-        if (it != mPool.end()) {
-            mIDs.free(m->id());
-            mPool.erase(it);
+        auto it = shard.pool.find(pe);
+        // The entry may belong to another monomial with the same content, if it was taken over while m was destructed or if the pool was cleared.
+        if (it != shard.pool.end() && it->id == m->id() && it->monomial.expired()) {
+            shard.pool.erase(it);
+            removed(1);
+            freeID(shard, m->id());
         }
     }
+#else
+    /**
+     * Ends an epoch: all monomials that are only referenced by the pool are destructed and their ids are released.
+     * As monomials are not released as soon as they are unused, this should be called regularly, for example after every check of an SMT solver.
+     * Other threads may create monomials meanwhile. Monomials they obtain from their thread-local caches are checked against the epoch, see
+     * validLookup(), and the caches are invalidated, as their weak pointers keep the slots of reclaimed monomials allocated.
+     * @return Number of monomials that were reclaimed.
+     */
+    std::size_t collect();
+#endif
+
+    /**
+     * Sets the number of entries of the thread-local creation caches that are consulted before the pool itself when creating monomials from their
+     * content. The size is rounded up to a power of two, zero disables the caches.
+     * @param size Number of entries per thread.
+     */
+    void setCreationCacheSize(std::size_t size) {
+        std::size_t s = 1;
+        while (s < size) s <<= 1;
+        mCreationCacheSize = (size == 0) ? 0 : s;
+        ++mCreationCacheGeneration;
+    }
+    std::size_t creationCacheSize() const {
+        return mCreationCacheSize;
+    }
+    /**
+     * @return Statistics of the creation cache of the calling thread.
+     */
+    static CreationCacheStatistics creationCacheStatistics();
+    /**
+     * Resets the statistics of the creation cache of the calling thread.
+     */
+    static void resetCreationCacheStatistics();
+
+    /**
+     * Sets the number of entries of the thread-local product caches, which store the products of pairs of monomials identified by their ids.
+     * The size is rounded up to a power of two, zero disables the caches. The caches are disabled by default.
+     * @param size Number of entries per thread.
+     */
+    void setProductCacheSize(std::size_t size) {
+        std::size_t s = 1;
+        while (s < size) s <<= 1;
+        mProductCacheSize = (size == 0) ? 0 : s;
+        ++mProductCacheGeneration;
+    }
+    std::size_t productCacheSize() const {
+        return mProductCacheSize;
+    }
+    /**
+     * Looks up the product of two monomials in the product cache of the calling thread.
+     * @param lhs First factor, must be pooled.
+     * @param rhs Second factor, must be pooled.
+     * @return The product of lhs and rhs, or nullptr if it is not cached.
+     */
+    Monomial::Arg cachedProduct(const Monomial::Arg& lhs, const Monomial::Arg& rhs);
+    /**
+     * Stores the product of two monomials in the product cache of the calling thread.
+     * @param lhs First factor, must be pooled.
+     * @param rhs Second factor, must be pooled.
+     * @param product The product of lhs and rhs.
+     */
+    void cacheProduct(const Monomial::Arg& lhs, const Monomial::Arg& rhs, const Monomial::Arg& product);
+    /**
+     * @return Statistics of the product cache of the calling thread.
+     */
+    static ProductCacheStatistics productCacheStatistics();
+    /**
+     * Resets the statistics of the product cache of the calling thread.
+     */
+    static void resetProductCacheStatistics();
+
+    /**
+     * Collects statistics about the pool. Iterates over all hash buckets.
+     * @return Statistics.
+     */
+    Statistics statistics() const;
+    /**
+     * Resets the peak size and all counters of the statistics.
+     */
+    void resetStatistics() {
+        mPeak = mLive.load();
+        mCreated = 0;
+        mHits = 0;
+        mFreed = 0;
+        mContendedLocks = 0;
+        mLockWaitTime = 0;
+    }
 
     /**
      * Clears everything already created in this pool.
      */
     void clear() {
-        mPool.clear();
-        mIDs.clear();
+        std::array<std::unique_lock<std::recursive_mutex>, NumShards> locks;
+        for (std::size_t i = 0; i < NumShards; ++i) {
+            locks[i] = lockShard(mShards[i]);
+        }
+        ++mCreationCacheGeneration;
+        ++mProductCacheGeneration;
+        for (auto& shard : mShards) {
+            removed(shard.pool.size());
+            shard.pool.clear();
+            shard.ids.clear();
+        }
+        mLargestID = 0;
+        // Id zero is reserved for the constant monomial.
+        getID(mShards[0]);
     }
 
     std::size_t size() const {
-        return mPool.size();
+        std::size_t res = 0;
+        for (const auto& shard : mShards) {
+            auto lock = lockShard(shard);
+            res += shard.pool.size();
+        }
+        return res;
     }
     std::size_t largestID() const {
-        return mIDs.largestID();
+        return mLargestID.load(std::memory_order_relaxed);
     }
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
     os << "MonomialPool of size " << mp.size() << std::endl;
-    for (const auto& entry : mp.mPool) {
-        os << "\t" << entry.content << " / " << entry.hash << std::endl;
+    for (const auto& shard : mp.mShards) {
+        for (const auto& entry : shard.pool) {
+            os << "\t" << entry.content << " / " << entry.hash << std::endl;
+        }
     }
     return os;
 }
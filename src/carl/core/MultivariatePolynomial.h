@@ -29,6 +29,8 @@ namespace carl {
 // forward declaration of UnivariatePolynomials
 template<typename Coeff>
 class UnivariatePolynomial;
+template<typename T>
+class EvaluationPlan;
 
 /**
  * The general-purpose multivariate polynomial class.
@@ -70,6 +72,16 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     using CACHE = std::vector<int>;
     /// Type our terms vector.f
     using TermsType = std::vector<Term<Coeff>>;
+    /// Maximal number of products of terms for which TermAddition multiplication is selected automatically.
+    static constexpr std::size_t TermAdditionMaxProducts = 1024;
+    /// Minimal number of products of terms for which Kronecker multiplication is selected automatically.
+    static constexpr std::size_t KroneckerMinProducts = 64;
+    /// Maximal ratio of the size of the substituted product and the number of products of terms for Kronecker multiplication.
+    static constexpr std::size_t KroneckerDensity = 4;
+    /// Maximal exponent for the multinomial expansion, which uses a table of binomial coefficients of quadratic size.
+    static constexpr std::size_t MultinomialMaxExponent = 1024;
+    /// Maximal number of products of powers of terms for the multinomial expansion.
+    static constexpr std::size_t MultinomialMaxProducts = std::size_t(1) << 24;
 
     template<typename C, typename T>
     using EnableIfNotSame = typename std::enable_if<!std::is_same<C, T>::value, T>::type;
@@ -82,10 +94,20 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     mutable TermsType mTerms;
     /// Flag that indicates if the terms are ordered.
     mutable bool mOrdered;
+    /// Variables with their degrees, sorted by variable. Computed on demand and reset whenever the terms are changed.
+    /// Const queries may run concurrently, hence it is only accessed atomically from const methods and never replaced once published.
+    mutable std::shared_ptr<const std::vector<std::pair<Variable, std::size_t>>> mVariableDegrees;
 
    public:
-    ///
-    static TermAdditionManager<MultivariatePolynomial, OrderedBy> mTermAdditionManager;
+    /**
+     * Retrieves the term addition manager of the calling thread.
+     * Every thread uses its own manager, hence concurrent additions do not synchronize.
+     * @return Term addition manager.
+     */
+    static TermAdditionManager<MultivariatePolynomial, OrderedBy>& termAdditionManager() {
+        static thread_local TermAdditionManager<MultivariatePolynomial, OrderedBy> manager;
+        return manager;
+    }
 
     enum class ConstructorOperation { ADD, SUB, MUL, DIV };
     friend std::ostream& operator<<(std::ostream& os, ConstructorOperation op) {
@@ -214,15 +236,11 @@ class MultivariatePolynomial : public Polynomial, public Policies {
      * @return Degree w.r.t. var.
      */
     std::size_t degree(Variable::Arg var) const {
-        std::size_t max = 0;
-        for (const auto& t : mTerms) {
-            if (t.monomial() == nullptr)
-                continue;
-            std::size_t c = t.monomial()->exponentOfVariable(var);
-            if (c > max)
-                max = c;
-        }
-        return max;
+        const auto& degrees = variableDegrees();
+        auto it = std::lower_bound(degrees.begin(), degrees.end(), var, [](const auto& d, Variable::Arg v) { return d.first < v; });
+        if (it == degrees.end() || it->first != var)
+            return 0;
+        return it->second;
     }
 
     /**
@@ -349,6 +367,7 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     typename TermsType::iterator eraseTerm(typename TermsType::iterator pos) {
         ///@todo find new lterm or constant term
         assert(false);
+        mVariableDegrees.reset();
         return mTerms.erase(pos);
     }
 
@@ -359,6 +378,7 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     //		return mTerms.erase(pos);
     //	}
     TermsType& getTerms() {
+        mVariableDegrees.reset();
         return mTerms;
     }
 
@@ -426,6 +446,14 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     void gatherVariables(std::set<Variable>& vars) const;
     std::set<Variable> gatherVariables() const;
 
+    /**
+     * Returns the variables occurring in this polynomial together with their degrees, sorted by variable.
+     * The result is computed on first use and cached until the polynomial is changed.
+     * gatherVariables(), has(), degree() and isUnivariate() are answered from this cache.
+     * @return Variables and degrees.
+     */
+    const std::vector<std::pair<Variable, std::size_t>>& variableDegrees() const;
+
     /**
      * @param v The variable to check for its occurrence.
      * @return true, if the variable occurs in this term.
@@ -434,12 +462,32 @@ class MultivariatePolynomial : public Polynomial, public Policies {
 
     bool isReducibleIdentity() const;
 
+    /**
+     * Add a term times a polynomial to this polynomial.
+     * The product is added term by term, without constructing it as a polynomial.
+     * @param factor Term.
+     * @param p Polynomial.
+     */
+    void addProduct(const Term<Coeff>& factor, const MultivariatePolynomial& p);
     /**
      * Subtract a term times a polynomial from this polynomial.
      * @param factor Term.
      * @param p Polynomial.
      */
     void subtractProduct(const Term<Coeff>& factor, const MultivariatePolynomial& p);
+    /**
+     * Add the product of two polynomials to this polynomial.
+     * All terms of the product are accumulated together with the terms of this polynomial in a single pass.
+     * @param a First factor.
+     * @param b Second factor.
+     */
+    void addProduct(const MultivariatePolynomial& a, const MultivariatePolynomial& b);
+    /**
+     * Subtract the product of two polynomials from this polynomial.
+     * @param a First factor.
+     * @param b Second factor.
+     */
+    void subtractProduct(const MultivariatePolynomial& a, const MultivariatePolynomial& b);
 
     /**
      * Adds a single term without using a TermAdditionManager or changing the ordering status.
@@ -543,6 +591,8 @@ class MultivariatePolynomial : public Polynomial, public Policies {
 
     /**
      * Replace all variables by a value given in their map.
+     * All variables are substituted simultaneously, i.e. variables occurring in the values are not substituted.
+     * Powers of the values are computed once for all terms and the result is accumulated without intermediate polynomials.
      * @return A new polynomial without the variables in map.
      */
     MultivariatePolynomial substitute(const std::map<Variable, MultivariatePolynomial>& substitutions) const;
@@ -568,6 +618,16 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     template<typename SubstitutionType = Coeff>
     SubstitutionType evaluate(const std::map<Variable, SubstitutionType>& substitutions) const;
 
+    /**
+     * Evaluates the polynomial at multiple points.
+     * The points are given as structure of arrays. To evaluate the same polynomial on multiple blocks, use an EvaluationPlan directly.
+     * @param variables Variables, must contain all variables of this polynomial.
+     * @param values Values of the variables, values[i][j] being the value of variables[i] at the j'th point.
+     * @return For every point, the function value at this point.
+     */
+    template<typename T>
+    std::vector<T> evaluateBatch(const std::vector<Variable>& variables, const std::vector<std::vector<T>>& values) const;
+
     bool divides(const MultivariatePolynomial& b) const;
     /**
      * Calculates the S-Polynomial.
@@ -592,7 +652,33 @@ class MultivariatePolynomial : public Polynomial, public Policies {
 
     void square();
 
-    MultivariatePolynomial pow(std::size_t exp) const;
+    /**
+     * Algorithms to compute powers of a polynomial.
+     *
+     * - Multiplication multiplies with the polynomial exp-1 times.
+     * - Squaring uses binary exponentiation, multiplying with the polynomial itself for every set bit of the exponent.
+     * - Multinomial expands the multinomial theorem, i.e. computes every product of powers of the terms exactly once.
+     *   This is efficient for sparse polynomials whose terms yield few coinciding monomials, for example \f$(x+y+z+1)^n\f$.
+     * - Automatic selects one of the above based on estimations of the sizes of the intermediate powers.
+     *
+     * Multinomial falls back to Squaring if the exponent or the number of products exceeds MultinomialMaxExponent or MultinomialMaxProducts.
+     */
+    enum class PowerStrategy { Multiplication, Squaring, Multinomial, Automatic };
+
+    /**
+     * Computes this polynomial to the given power.
+     * @param exp Exponent.
+     * @param strategy Algorithm to use.
+     * @return This polynomial to the power of exp.
+     */
+    MultivariatePolynomial pow(std::size_t exp, PowerStrategy strategy = PowerStrategy::Automatic) const;
+
+    /**
+     * Select the algorithm to compute the given power of this polynomial.
+     * @param exp Exponent.
+     * @return Algorithm, never PowerStrategy::Automatic.
+     */
+    PowerStrategy powerStrategy(std::size_t exp) const;
 
     MultivariatePolynomial naive_pow(unsigned exp) const;
 
@@ -608,6 +694,12 @@ class MultivariatePolynomial : public Polynomial, public Policies {
      * i.e., be indeed univariate.
      */
     UnivariatePolynomial<Coeff> toUnivariatePolynomial() const;
+    /**
+     * Convert to a univariate polynomial in the given variable with multivariate coefficients.
+     * The terms are distributed to the coefficients in a single pass.
+     * @param mainVar Main variable.
+     * @return Univariate polynomial.
+     */
     UnivariatePolynomial<MultivariatePolynomial> toUnivariatePolynomial(Variable::Arg mainVar) const;
 
     const Term<Coeff>& operator[](unsigned index) const;
@@ -657,7 +749,9 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     MultivariatePolynomial& operator-=(const Coeff& rhs);
     /// @}
 
-    MultivariatePolynomial operator-() const;
+    MultivariatePolynomial operator-() const&;
+    /// Negation of a temporary, which reuses its terms.
+    MultivariatePolynomial operator-() &&;
 
     /// @name In-place multiplication operators
     /// @{
@@ -673,6 +767,78 @@ class MultivariatePolynomial : public Polynomial, public Policies {
     MultivariatePolynomial& operator*=(const Coeff& rhs);
     /// @}
 
+    /**
+     * Algorithms to multiply two polynomials.
+     *
+     * - TermAddition collects all pairwise products in the term addition manager and only establishes the minimal ordering.
+     * - Heap merges the rows of the product with a heap (Johnson's algorithm) whose size is bounded by the number of terms of the smaller operand.
+     * - Geobucket merges the rows of the product into buckets of geometrically increasing sizes.
+     * - Kronecker maps both operands to big integers by Kronecker substitution and multiplies them with a single GMP multiplication.
+     *   It is only available for GMP coefficients and if the product is dense, otherwise TermAddition or Heap is used.
+     * - Automatic selects one of the above based on the sizes of the operands.
+     *
+     * Heap and Geobucket yield fully ordered results.
+     */
+    enum class MultiplicationStrategy { TermAddition, Heap, Geobucket, Kronecker, Automatic };
+
+    /**
+     * Multiply this polynomial with another polynomial using the given algorithm.
+     * @param rhs Right hand side.
+     * @param strategy Multiplication algorithm.
+     * @return Changed polynomial.
+     */
+    MultivariatePolynomial& multiply(const MultivariatePolynomial& rhs, MultiplicationStrategy strategy);
+
+    /**
+     * Select the multiplication algorithm for operands of the given sizes.
+     * @param lhsTerms Number of terms of the left hand side.
+     * @param rhsTerms Number of terms of the right hand side.
+     * @return Multiplication algorithm, never MultiplicationStrategy::Automatic.
+     */
+    static MultiplicationStrategy multiplicationStrategy(std::size_t lhsTerms, std::size_t rhsTerms);
+
+   private:
+    /**
+     * Merge two fully ordered sequences of terms, adding coefficients of equal monomials and dropping zero terms.
+     * The terms are moved from the arguments.
+     * @param lhs First sequence.
+     * @param rhs Second sequence.
+     * @return Fully ordered sum.
+     */
+    static TermsType mergeTerms(TermsType&& lhs, TermsType&& rhs);
+    void multiplyByTermAddition(const MultivariatePolynomial& rhs);
+    void multiplyByHeap(const MultivariatePolynomial& rhs);
+    void multiplyByGeobucket(const MultivariatePolynomial& rhs);
+    /**
+     * Multiply by Kronecker substitution, see kroneckerMultiply().
+     * Fails if the coefficients are no GMP numbers or if the substituted polynomial has more than KroneckerDensity coefficients per product of
+     * terms.
+     * @param rhs Right hand side.
+     * @return If this polynomial was multiplied.
+     */
+    bool multiplyByKronecker(const MultivariatePolynomial& rhs);
+    /**
+     * Add or subtract the product of two polynomials, see addProduct() and subtractProduct().
+     * @param a First factor.
+     * @param b Second factor.
+     * @param negate If the product is subtracted.
+     */
+    void addSignedProduct(const MultivariatePolynomial& a, const MultivariatePolynomial& b, bool negate);
+    /**
+     * Computes the variables with their degrees without using the cache, see variableDegrees().
+     * @return Variables and degrees.
+     */
+    std::vector<std::pair<Variable, std::size_t>> computeVariableDegrees() const;
+    MultivariatePolynomial squaringPow(std::size_t exp) const;
+    MultivariatePolynomial multinomialPow(std::size_t exp) const;
+    /**
+     * Counts the products of powers of the terms that the multinomial expansion computes for the given exponent.
+     * @param exp Exponent.
+     * @return Number of products, saturated at the largest std::size_t.
+     */
+    std::size_t multinomialProducts(std::size_t exp) const;
+
+   public:
     /// @name In-place division operators
     /// @{
     /**
@@ -1142,6 +1308,57 @@ inline MultivariatePolynomial<C, O, P> operator+(const C& lhs, Variable::Arg rhs
     return MultivariatePolynomial<C, O, P>(rhs) += lhs;
 }
 
+/**
+ * Overloads for temporary polynomials, which reuse the terms of the temporary instead of copying them.
+ */
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(const MultivariatePolynomial<C, O, P>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    if (lhs.nrTerms() < rhs.nrTerms()) {
+        return std::move(rhs += lhs);
+    }
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, const Term<C>& rhs) {
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, const Monomial::Arg& rhs) {
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, Variable::Arg rhs) {
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator+(MultivariatePolynomial<C, O, P>&& lhs, const C& rhs) {
+    return std::move(lhs += rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(const Term<C>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(const Monomial::Arg& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator+(Variable::Arg lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs += lhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator+(const C& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs += lhs);
+}
+
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C, O, P> operator+(const MultivariatePolynomial<C, O, P>& lhs, const UnivariatePolynomial<C>& rhs);
 template<typename C, typename O, typename P>
@@ -1256,6 +1473,58 @@ template<MPOpTemplate, EnableIf<carl::is_number<C>> = dummy>
 inline MultivariatePolynomial<C, O, P> operator-(const C& lhs, Variable::Arg rhs) {
     return MultivariatePolynomial<C, O, P>(lhs) -= rhs;
 }
+/**
+ * Overloads for temporary polynomials, which reuse the terms of the temporary instead of copying them.
+ */
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(const MultivariatePolynomial<C, O, P>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    MultivariatePolynomial<C, O, P> res = -std::move(rhs);
+    return std::move(res += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, const Term<C>& rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, const Monomial::Arg& rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, Variable::Arg rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator-(MultivariatePolynomial<C, O, P>&& lhs, const C& rhs) {
+    return std::move(lhs -= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(const Term<C>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    MultivariatePolynomial<C, O, P> res = -std::move(rhs);
+    return std::move(res += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(const Monomial::Arg& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    MultivariatePolynomial<C, O, P> res = -std::move(rhs);
+    return std::move(res += lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator-(Variable::Arg lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    MultivariatePolynomial<C, O, P> res = -std::move(rhs);
+    return std::move(res += lhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator-(const C& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    MultivariatePolynomial<C, O, P> res = -std::move(rhs);
+    return std::move(res += lhs);
+}
 /// @}
 
 /// @name Multiplication operators
@@ -1288,21 +1557,69 @@ inline MultivariatePolynomial<C, O, P> operator*(const MultivariatePolynomial<C,
 }
 template<typename C, typename O, typename P>
 inline MultivariatePolynomial<C, O, P> operator*(const Term<C>& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
-    return MultivariatePolynomial<C, O, P>(lhs) *= rhs;
+    return MultivariatePolynomial<C, O, P>(rhs) *= lhs;
 }
 template<typename C, typename O, typename P>
 inline MultivariatePolynomial<C, O, P> operator*(const Monomial::Arg& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
-    return MultivariatePolynomial<C, O, P>(lhs) *= rhs;
+    return MultivariatePolynomial<C, O, P>(rhs) *= lhs;
 }
 template<typename C, typename O, typename P>
 inline MultivariatePolynomial<C, O, P> operator*(Variable::Arg lhs, const MultivariatePolynomial<C, O, P>& rhs) {
-    return MultivariatePolynomial<C, O, P>(lhs) *= rhs;
+    return MultivariatePolynomial<C, O, P>(rhs) *= lhs;
 }
 template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
 inline MultivariatePolynomial<C, O, P> operator*(const C& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
     return MultivariatePolynomial<C, O, P>(rhs) *= lhs;
 }
 
+/**
+ * Overloads for temporary polynomials, which reuse the terms of the temporary instead of copying them.
+ */
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(const MultivariatePolynomial<C, O, P>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs *= lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, const Term<C>& rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, const Monomial::Arg& rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, Variable::Arg rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator*(MultivariatePolynomial<C, O, P>&& lhs, const C& rhs) {
+    return std::move(lhs *= rhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(const Term<C>& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs *= lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(const Monomial::Arg& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs *= lhs);
+}
+template<typename C, typename O, typename P>
+inline MultivariatePolynomial<C, O, P> operator*(Variable::Arg lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs *= lhs);
+}
+template<typename C, typename O, typename P, EnableIf<carl::is_number<C>> = dummy>
+inline MultivariatePolynomial<C, O, P> operator*(const C& lhs, MultivariatePolynomial<C, O, P>&& rhs) {
+    return std::move(rhs *= lhs);
+}
+
 template<typename C, typename O, typename P>
 inline const MultivariatePolynomial<C, O, P> operator*(const UnivariatePolynomial<C>& lhs, const MultivariatePolynomial<C, O, P>& rhs);
 template<typename C, typename O, typename P>
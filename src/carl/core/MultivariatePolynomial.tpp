@@ -9,6 +9,8 @@
 #include "MultivariatePolynomial.h"
 
 #include "../numbers/numbers.h"
+#include "EvaluationPlan.h"
+#include "KroneckerSubstitution.h"
 #include "Term.h"
 #include "UnivariatePolynomial.h"
 #include "logging.h"
@@ -16,16 +18,19 @@
 #include "polynomialfunctions/CoprimePart.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <tuple>
 #include <type_traits>
 
 namespace carl {
 
-template<typename Coeff, typename Ordering, typename Policies>
-TermAdditionManager<MultivariatePolynomial<Coeff, Ordering, Policies>, GrLexOrdering> MultivariatePolynomial<Coeff, Ordering, Policies>::mTermAdditionManager;
-
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial() : mTerms(), mOrdered(true) {
     assert(this->isConsistent());
@@ -33,13 +38,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial() : mT
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const MultivariatePolynomial<Coeff, Ordering, Policies>& p)
-    : Policies(p), mTerms(p.mTerms), mOrdered(p.isOrdered()) {
+    : Policies(p), mTerms(p.mTerms), mOrdered(p.isOrdered()), mVariableDegrees(std::atomic_load(&p.mVariableDegrees)) {
     assert(this->isConsistent());
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(MultivariatePolynomial<Coeff, Ordering, Policies>&& p)
-    : Policies(p), mTerms(std::move(p.mTerms)), mOrdered(p.isOrdered()) {
+    : Policies(p), mTerms(std::move(p.mTerms)), mOrdered(p.isOrdered()), mVariableDegrees(std::move(p.mVariableDegrees)) {
+    p.mVariableDegrees.reset();
     assert(this->isConsistent());
 }
 
@@ -49,6 +55,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
     Policies::operator=(p);
     mTerms = p.mTerms;
     mOrdered = p.mOrdered;
+    mVariableDegrees = std::atomic_load(&p.mVariableDegrees);
     assert(this->isConsistent());
     return *this;
 }
@@ -59,6 +66,8 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
     Policies::operator=(p);
     mTerms = std::move(p.mTerms);
     mOrdered = p.mOrdered;
+    mVariableDegrees = std::move(p.mVariableDegrees);
+    p.mVariableDegrees.reset();
     assert(this->isConsistent());
     return *this;
 }
@@ -104,19 +113,19 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const UnivariatePolynomial<MultivariatePolynomial<Coeff, Ordering, Policies>>& p)
     : Policies(), mTerms(), mOrdered(false) {
-    auto id = mTermAdditionManager.getId();
+    auto id = termAdditionManager().getId();
     exponent exp = 0;
     for (const auto& c : p.coefficients()) {
         if (exp == 0) {
-            for (const auto& term : c) mTermAdditionManager.template addTerm<true>(id, term);
+            for (const auto& term : c) termAdditionManager().template addTerm<true>(id, term);
         } else {
             for (const auto& term : c* Term<Coeff>(constant_one<Coeff>::get(), p.mainVar(), exp)) {
-                mTermAdditionManager.template addTerm<true>(id, term);
+                termAdditionManager().template addTerm<true>(id, term);
             }
         }
         exp++;
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     makeMinimallyOrdered<false, true>();
     assert(this->isConsistent());
 }
@@ -156,9 +165,9 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(Multiv
       mTerms(std::move(terms)),
       mOrdered(ordered) {
     if (duplicates) {
-        auto id = mTermAdditionManager.getId(mTerms.size());
-        for (const auto& t : mTerms) mTermAdditionManager.template addTerm<false>(id, t);
-        mTermAdditionManager.readTerms(id, mTerms);
+        auto id = termAdditionManager().getId(mTerms.size());
+        for (const auto& t : mTerms) termAdditionManager().template addTerm<false>(id, t);
+        termAdditionManager().readTerms(id, mTerms);
         mOrdered = false;
     }
 
@@ -181,11 +190,11 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const
       mTerms(terms),
       mOrdered(ordered) {
     if (duplicates) {
-        auto id = mTermAdditionManager.getId(mTerms.size());
+        auto id = termAdditionManager().getId(mTerms.size());
         for (const auto& t : mTerms) {
-            mTermAdditionManager.template addTerm<false>(id, t);
+            termAdditionManager().template addTerm<false>(id, t);
         }
-        mTermAdditionManager.readTerms(id, mTerms);
+        termAdditionManager().readTerms(id, mTerms);
     }
     if (!ordered) {
         makeMinimallyOrdered();
@@ -260,6 +269,7 @@ const Term<Coeff>& MultivariatePolynomial<Coeff, Ordering, Policies>::lterm() co
 }
 template<typename Coeff, typename Ordering, typename Policies>
 Term<Coeff>& MultivariatePolynomial<Coeff, Ordering, Policies>::lterm() {
+    mVariableDegrees.reset();
     CARL_LOG_ASSERT("carl.core", !isZero(), "Leading term undefined on zero polynomials.");
     return mTerms.back();
 }
@@ -272,6 +282,7 @@ const Term<Coeff>& MultivariatePolynomial<Coeff, Ordering, Policies>::trailingTe
 
 template<typename Coeff, typename Ordering, typename Policies>
 Term<Coeff>& MultivariatePolynomial<Coeff, Ordering, Policies>::trailingTerm() {
+    mVariableDegrees.reset();
     CARL_LOG_ASSERT("carl.core", !isZero(), "Trailing term undefined on zero polynomials.");
     return mTerms.front();
 }
@@ -440,6 +451,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::stripLT() {
+    mVariableDegrees.reset();
     assert(!isZero());
     mTerms.pop_back();
     if (!isOrdered())
@@ -451,19 +463,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 template<typename Coeff, typename Ordering, typename Policies>
 bool MultivariatePolynomial<Coeff, Ordering, Policies>::isUnivariate() const {
     // A constant polynomial is obviously univariate.
-    if (isConstant())
-        return true;
-
-    if (this->lterm().getNrVariables() > 1) {
-        return false;
-    }
-
-    Variable v = lterm().getSingleVariable();
-    for (const auto& term : mTerms) {
-        if (!term.hasNoOtherVariable(v))
-            return false;
-    }
-    return true;
+    return variableDegrees().size() <= 1;
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
@@ -478,10 +478,7 @@ bool MultivariatePolynomial<Coeff, Ordering, Policies>::isTsos() const {
 
 template<typename Coeff, typename Ordering, typename Policies>
 bool MultivariatePolynomial<Coeff, Ordering, Policies>::has(Variable::Arg v) const {
-    for (auto& term : mTerms)
-        if (term.has(v))
-            return true;
-    return false;
+    return degree(v) > 0;
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
@@ -491,35 +488,77 @@ bool MultivariatePolynomial<Coeff, Ordering, Policies>::isReducibleIdentity() co
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
-void MultivariatePolynomial<Coeff, Ordering, Policies>::subtractProduct(const Term<Coeff>& factor, const MultivariatePolynomial<Coeff, Ordering, Policies>& p) {
+void MultivariatePolynomial<Coeff, Ordering, Policies>::addProduct(const Term<Coeff>& factor, const MultivariatePolynomial<Coeff, Ordering, Policies>& p) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
     assert(p.isConsistent());
-    if (p.isZero())
+    if (p.isZero() || carl::isZero(factor.coeff()))
         return;
     if (isZero()) {
-        *this = -factor * p;
+        *this = p;
+        *this *= factor;
         assert(this->isConsistent());
-    }
-    if (carl::isZero(factor.coeff()))
         return;
+    }
     if (p.nrTerms() == 1) {
-        for (const auto& t : p) {
-            this->addTerm(-factor * t);
-        }
+        this->addTerm(factor * p.lterm());
         assert(isConsistent());
         return;
     }
 
-    auto id = mTermAdditionManager.getId(mTerms.size() + p.mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size() + p.mTerms.size());
     for (const auto& term : mTerms) {
-        mTermAdditionManager.template addTerm<false>(id, term);
+        termAdditionManager().template addTerm<false>(id, term);
     }
     for (const auto& term : p.mTerms) {
-        Coeff c = -factor.coeff() * term.coeff();
-        auto m = factor.monomial() * term.monomial();
-        mTermAdditionManager.template addTerm<false>(id, TermType(c, m));
+        termAdditionManager().template addTerm<false>(id, TermType(factor.coeff() * term.coeff(), factor.monomial() * term.monomial()));
+    }
+    termAdditionManager().readTerms(id, mTerms);
+    mOrdered = false;
+    makeMinimallyOrdered<false, true>();
+    assert(this->isConsistent());
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::subtractProduct(const Term<Coeff>& factor, const MultivariatePolynomial<Coeff, Ordering, Policies>& p) {
+    mVariableDegrees.reset();
+    addProduct(-factor, p);
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::addProduct(const MultivariatePolynomial<Coeff, Ordering, Policies>& a,
+                                                                    const MultivariatePolynomial<Coeff, Ordering, Policies>& b) {
+    addSignedProduct(a, b, false);
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::subtractProduct(const MultivariatePolynomial<Coeff, Ordering, Policies>& a,
+                                                                         const MultivariatePolynomial<Coeff, Ordering, Policies>& b) {
+    addSignedProduct(a, b, true);
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::addSignedProduct(const MultivariatePolynomial<Coeff, Ordering, Policies>& a,
+                                                                          const MultivariatePolynomial<Coeff, Ordering, Policies>& b, bool negate) {
+    mVariableDegrees.reset();
+    assert(this->isConsistent());
+    assert(a.isConsistent());
+    assert(b.isConsistent());
+    if (a.isZero() || b.isZero())
+        return;
+    auto id = termAdditionManager().getId(mTerms.size() + a.mTerms.size() * b.mTerms.size());
+    for (const auto& term : mTerms) {
+        termAdditionManager().template addTerm<false>(id, term);
+    }
+    for (const auto& ta : a.mTerms) {
+        for (const auto& tb : b.mTerms) {
+            Coeff coeff = ta.coeff() * tb.coeff();
+            if (negate)
+                coeff = -coeff;
+            termAdditionManager().template addTerm<false>(id, TermType(std::move(coeff), ta.monomial() * tb.monomial()));
+        }
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     mOrdered = false;
     makeMinimallyOrdered<false, true>();
     assert(this->isConsistent());
@@ -527,6 +566,7 @@ void MultivariatePolynomial<Coeff, Ordering, Policies>::subtractProduct(const Te
 
 template<typename Coeff, typename Ordering, typename Policies>
 void MultivariatePolynomial<Coeff, Ordering, Policies>::addTerm(const Term<Coeff>& term) {
+    mVariableDegrees.reset();
     // std::cout << *this << " + " << term << std::endl;
     if (term.isConstant()) {
         if (hasConstantTerm()) {
@@ -617,28 +657,29 @@ bool MultivariatePolynomial<Coeff, Ordering, Policies>::divideBy(const Multivari
         quotient = MultivariatePolynomial();
         return true;
     }
-    auto id = mTermAdditionManager.getId(0);
-    auto thisid = mTermAdditionManager.getId(mTerms.size());
+    auto id = termAdditionManager().getId(0);
+    auto thisid = termAdditionManager().getId(mTerms.size());
     for (const auto& t : mTerms) {
-        mTermAdditionManager.template addTerm<false, true>(thisid, t);
+        termAdditionManager().template addTerm<false, true>(thisid, t);
     }
     while (true) {
-        Term<C> factor = mTermAdditionManager.getMaxTerm(thisid);
+        Term<C> factor = termAdditionManager().getMaxTerm(thisid);
         if (factor.isZero())
             break;
         if (factor.divide(divisor.lterm(), factor)) {
             for (const auto& t : divisor) {
-                mTermAdditionManager.template addTerm<true, true>(thisid, -factor * t);
+                termAdditionManager().template addTerm<true, true>(thisid, -factor * t);
             }
             // res.subtractProduct(factor, divisor);
             // p -= factor * divisor;
-            mTermAdditionManager.template addTerm<true>(id, factor);
+            termAdditionManager().template addTerm<true>(id, factor);
         } else {
             return false;
         }
     }
-    mTermAdditionManager.readTerms(id, quotient.mTerms);
-    mTermAdditionManager.dropTerms(thisid);
+    termAdditionManager().readTerms(id, quotient.mTerms);
+    quotient.mVariableDegrees.reset();
+    termAdditionManager().dropTerms(thisid);
     quotient.mOrdered = false;
     quotient.makeMinimallyOrdered<false, true>();
     assert(quotient.isConsistent());
@@ -679,19 +720,19 @@ MultivariatePolynomial<C, O, P> MultivariatePolynomial<C, O, P>::quotient(const
     }
     // static_assert(is_field<C>::value, "Division only defined for field coefficients");
     MultivariatePolynomial p(*this);
-    auto id = mTermAdditionManager.getId(p.mTerms.size());
+    auto id = termAdditionManager().getId(p.mTerms.size());
     while (!p.isZero()) {
         Term<C> factor;
         if (p.lterm().divide(divisor.lterm(), factor)) {
             // p -= factor * divisor;
             p.subtractProduct(factor, divisor);
-            mTermAdditionManager.template addTerm<true>(id, factor);
+            termAdditionManager().template addTerm<true>(id, factor);
         } else {
             p.stripLT();
         }
     }
     MultivariatePolynomial<C, O, P> result;
-    mTermAdditionManager.readTerms(id, result.mTerms);
+    termAdditionManager().readTerms(id, result.mTerms);
     result.mOrdered = false;
     result.makeMinimallyOrdered<false, true>();
     assert(result.isConsistent());
@@ -749,6 +790,7 @@ void MultivariatePolynomial<Coeff, Ordering, Policies>::substituteIn(Variable::A
     if (!this->has(var)) {
         return;
     }
+    mVariableDegrees.reset();
     TermsType newTerms;
     // If we replace a variable by zero, just eliminate all terms containing the variable.
     if (value.isZero()) {
@@ -812,10 +854,10 @@ void MultivariatePolynomial<Coeff, Ordering, Policies>::substituteIn(Variable::A
         }
     }
     // Substitute the variable.
-    auto id = mTermAdditionManager.getId(expectedResultSize);
+    auto id = termAdditionManager().getId(expectedResultSize);
     for (const auto& term : mTerms) {
         if (term.monomial() == nullptr) {
-            mTermAdditionManager.template addTerm<false>(id, term);
+            termAdditionManager().template addTerm<false>(id, term);
         } else {
             exponent e = term.monomial()->exponentOfVariable(var);
             Monomial::Arg mon;
@@ -824,29 +866,29 @@ void MultivariatePolynomial<Coeff, Ordering, Policies>::substituteIn(Variable::A
             if (e == 1) {
                 for (auto vterm : value.mTerms) {
                     if (mon == nullptr)
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
                     else if (vterm.monomial() == nullptr)
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
                     else
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
                 }
             } else if (e > 1) {
                 auto iter = expResults.find(e);
                 assert(iter != expResults.end());
                 for (auto vterm : iter->second.first.mTerms) {
                     if (mon == nullptr)
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
                     else if (vterm.monomial() == nullptr)
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
                     else
-                        mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
+                        termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
                 }
             } else {
-                mTermAdditionManager.template addTerm<false>(id, term);
+                termAdditionManager().template addTerm<false>(id, term);
             }
         }
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     mOrdered = false;
     makeMinimallyOrdered<false, true>();
     assert(mTerms.size() <= expectedResultSize);
@@ -864,95 +906,104 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::substitute(
     const std::map<Variable, MultivariatePolynomial<Coeff, Ordering, Policies>>& substitutions) const {
-    MultivariatePolynomial result(*this);
     if (isConstant() || substitutions.empty()) {
-        return result;
+        return *this;
     }
-    // Substitute the variables, which have to be replaced by 0, beforehand,
-    // as this could significantly simplify this multivariate polynomial.
-    for (auto sub = substitutions.begin(); sub != substitutions.end(); ++sub) {
-        if (sub->second.isZero()) {
-            result.substituteIn(sub->first, sub->second);
-            if (result.isConstant()) {
-                assert(result.isConsistent());
-                return result;
+    using Exponents = std::vector<std::pair<Variable, exponent>>;
+    // All variables are substituted simultaneously: every term is split into the powers of the substituted variables and the remaining monomial.
+    // powers maps var^e to value^e for e > 1, products maps a product of several such powers to its value. Both are shared by all terms.
+    std::map<std::pair<Variable, exponent>, MultivariatePolynomial> powers;
+    std::map<Exponents, MultivariatePolynomial> products;
+    for (const auto& term : mTerms) {
+        if (!term.monomial())
+            continue;
+        for (const auto& ve : *term.monomial()) {
+            if (ve.second > 1 && substitutions.find(ve.first) != substitutions.end()) {
+                powers.emplace(ve, MultivariatePolynomial());
             }
         }
     }
-    // Find and sort all exponents occurring for all variables to substitute as basis.
-    std::map<std::pair<Variable, exponent>, MultivariatePolynomial> expResults;
-    for (const auto& term : result.mTerms) {
-        if (term.monomial()) {
-            const Monomial& m = *(term.monomial());
-            CARL_LOG_TRACE("carl.core.monomial", "Iterating over " << m);
-            for (unsigned i = 0; i < m.nrVariables(); ++i) {
-                CARL_LOG_TRACE("carl.core.monomial", "Iterating: " << m[i].first);
-                if (m[i].second > 1 && substitutions.find(m[i].first) != substitutions.end()) {
-                    expResults[m[i]] = MultivariatePolynomial(constant_one<Coeff>::get());
-                }
-            }
+    // Calculate the powers of every value incrementally from the next smaller one.
+    for (auto it = powers.begin(); it != powers.end(); ++it) {
+        const MultivariatePolynomial& value = substitutions.find(it->first.first)->second;
+        if (it != powers.begin() && std::prev(it)->first.first == it->first.first) {
+            it->second = std::prev(it)->second * value.pow(it->first.second - std::prev(it)->first.second);
+        } else {
+            it->second = value.pow(it->first.second);
         }
     }
-    // Calculate the exponentiation of the multivariate polynomial to substitute the
-    // for variables for, reusing the already calculated exponentiations.
-    if (!expResults.empty()) {
-        auto expResultA = expResults.begin();
-        auto expResultB = expResultA;
-        auto sub = substitutions.begin();
-        while (sub->first != expResultB->first.first) {
-            assert(sub != substitutions.end());
-            ++sub;
+    auto power = [&](const std::pair<Variable, exponent>& ve) -> const MultivariatePolynomial& {
+        if (ve.second == 1)
+            return substitutions.find(ve.first)->second;
+        return powers.find(ve)->second;
+    };
+    // Every term is replaced by the product of its coefficient, the remaining monomial and the value of its substituted part.
+    std::vector<std::tuple<const Term<Coeff>*, Monomial::Arg, const MultivariatePolynomial*>> parts;
+    parts.reserve(mTerms.size());
+    std::size_t expectedResultSize = 0;
+    Exponents substituted;
+    Exponents remaining;
+    for (const auto& term : mTerms) {
+        if (!term.monomial()) {
+            parts.emplace_back(&term, nullptr, nullptr);
+            ++expectedResultSize;
+            continue;
         }
-        expResultB->second = sub->second.pow(expResultB->first.second);
-        ++expResultB;
-        while (expResultB != expResults.end()) {
-            if (expResultA->first.first != expResultB->first.first) {
-                ++sub;
-                assert(sub != substitutions.end());
-                // Go to the next variable.
-                while (sub->first != expResultB->first.first) {
-                    assert(sub != substitutions.end());
-                    ++sub;
-                }
-                assert(sub->first == expResultB->first.first);
-                expResultB->second = sub->second.pow(expResultB->first.second);
+        substituted.clear();
+        remaining.clear();
+        exponent remainingDegree = 0;
+        for (const auto& ve : *term.monomial()) {
+            if (substitutions.find(ve.first) != substitutions.end()) {
+                substituted.push_back(ve);
             } else {
-                expResultB->second = expResultA->second * sub->second.pow(expResultB->first.second - expResultA->first.second);
+                remaining.push_back(ve);
+                remainingDegree += ve.second;
             }
-            ++expResultA;
-            ++expResultB;
         }
-    }
-    MultivariatePolynomial resultB;
-    // Substitute the variable for which all occurring exponentiations are calculated.
-    for (const auto& term : result.mTerms) {
-        MultivariatePolynomial termResult(term.coeff());
-        if (term.monomial()) {
-            const Monomial& m = *(term.monomial());
-            CARL_LOG_TRACE("carl.core.monomial", "Iterating over " << m);
-            for (unsigned i = 0; i < m.nrVariables(); ++i) {
-                CARL_LOG_TRACE("carl.core.monomial", "Iterating: " << m[i].first);
-                if (m[i].second == 1) {
-                    auto iter = substitutions.find(m[i].first);
-                    if (iter != substitutions.end()) {
-                        termResult *= iter->second;
-                    } else {
-                        termResult *= m[i].first;
-                    }
-                } else {
-                    auto iter = expResults.find(m[i]);
-                    if (iter != expResults.end()) {
-                        termResult *= iter->second;
-                    } else {
-                        termResult *= Term<Coeff>(constant_one<Coeff>::get(), m[i].first, m[i].second);
-                    }
+        if (substituted.empty()) {
+            parts.emplace_back(&term, term.monomial(), nullptr);
+            ++expectedResultSize;
+            continue;
+        }
+        const MultivariatePolynomial* value = &power(substituted.front());
+        if (substituted.size() > 1) {
+            auto it = products.find(substituted);
+            if (it == products.end()) {
+                MultivariatePolynomial product = *value;
+                for (std::size_t i = 1; i < substituted.size() && !product.isZero(); ++i) {
+                    product *= power(substituted[i]);
                 }
+                it = products.emplace(substituted, std::move(product)).first;
             }
+            value = &it->second;
+        }
+        if (value->isZero())
+            continue;
+        Monomial::Arg mon = remaining.empty() ? nullptr : createMonomial(Exponents(remaining), remainingDegree);
+        parts.emplace_back(&term, mon, value);
+        expectedResultSize += value->nrTerms();
+    }
+    MultivariatePolynomial result;
+    auto id = termAdditionManager().getId(expectedResultSize);
+    for (const auto& [term, mon, value] : parts) {
+        if (value == nullptr) {
+            termAdditionManager().template addTerm<false>(id, Term<Coeff>(term->coeff(), mon));
+            continue;
+        }
+        for (const auto& vterm : value->mTerms) {
+            if (mon == nullptr)
+                termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term->coeff(), vterm.monomial()));
+            else if (vterm.monomial() == nullptr)
+                termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term->coeff(), mon));
+            else
+                termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term->coeff(), vterm.monomial() * mon));
         }
-        resultB += termResult;
     }
-    assert(resultB.isConsistent());
-    return resultB;
+    termAdditionManager().readTerms(id, result.mTerms);
+    result.mOrdered = false;
+    result.makeMinimallyOrdered<false, true>();
+    assert(result.isConsistent());
+    return result;
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
@@ -961,14 +1012,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
     const std::map<Variable, SubstitutionType>& substitutions) const {
     static_assert(!std::is_same<SubstitutionType, Term<Coeff>>::value, "Terms are handled by a seperate method.");
     MultivariatePolynomial result;
-    auto id = mTermAdditionManager.getId(mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size());
     for (const auto& term : mTerms) {
         Term<Coeff> resultTerm = term.substitute(substitutions);
         if (!resultTerm.isZero()) {
-            mTermAdditionManager.template addTerm<false>(id, resultTerm);
+            termAdditionManager().template addTerm<false>(id, resultTerm);
         }
     }
-    mTermAdditionManager.readTerms(id, result.mTerms);
+    termAdditionManager().readTerms(id, result.mTerms);
     result.mOrdered = false;
     result.makeMinimallyOrdered<false, true>();
     assert(result.isConsistent());
@@ -979,11 +1030,11 @@ template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::substitute(
     const std::map<Variable, Term<Coeff>>& substitutions) const {
     MultivariatePolynomial result;
-    auto id = mTermAdditionManager.getId(mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size());
     for (const auto& term : mTerms) {
-        mTermAdditionManager.template addTerm<false>(id, term.substitute(substitutions));
+        termAdditionManager().template addTerm<false>(id, term.substitute(substitutions));
     }
-    mTermAdditionManager.readTerms(id, result.mTerms);
+    termAdditionManager().readTerms(id, result.mTerms);
     result.mOrdered = false;
     result.makeMinimallyOrdered<false, true>();
     assert(result.isConsistent());
@@ -1004,6 +1055,13 @@ SubstitutionType MultivariatePolynomial<Coeff, Ordering, Policies>::evaluate(con
     };
 }
 
+template<typename Coeff, typename Ordering, typename Policies>
+template<typename T>
+std::vector<T> MultivariatePolynomial<Coeff, Ordering, Policies>::evaluateBatch(const std::vector<Variable>& variables,
+                                                                                const std::vector<std::vector<T>>& values) const {
+    return EvaluationPlan<T>(*this, variables).evaluateBatch(values);
+}
+
 template<typename Coeff, typename Ordering, typename Policies>
 template<typename C, EnableIf<is_subset_of_rationals<C>>>
 Coeff MultivariatePolynomial<Coeff, Ordering, Policies>::coprimeFactor() const {
@@ -1109,51 +1167,171 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 void MultivariatePolynomial<Coeff, Ordering, Policies>::square() {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
-    auto id = mTermAdditionManager.getId(mTerms.size() * mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size() * mTerms.size());
     Term<Coeff> newlterm;
     for (auto it1 = mTerms.rbegin(); it1 != mTerms.rend(); it1++) {
         if (it1 == mTerms.rbegin())
             newlterm = it1->pow(2);
         else
-            mTermAdditionManager.template addTerm<false>(id, it1->pow(2));
+            termAdditionManager().template addTerm<false>(id, it1->pow(2));
         for (auto it2 = it1 + 1; it2 != mTerms.rend(); it2++) {
-            mTermAdditionManager.template addTerm<false>(id, Coeff(2) * *it1 * *it2);
+            termAdditionManager().template addTerm<false>(id, Coeff(2) * *it1 * *it2);
         }
     }
     mOrdered = false;
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     if (!newlterm.isZero())
         mTerms.push_back(newlterm);
     assert(this->isConsistent());
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
-MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::pow(std::size_t exp) const {
-    // std::cout << "pw(" << *this << " ^ " << exp << ")" << std::endl;
+MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::pow(std::size_t exp, PowerStrategy strategy) const {
     if (isZero())
         return MultivariatePolynomial(constant_zero<Coeff>::get());
     if (exp == 0)
         return MultivariatePolynomial(constant_one<Coeff>::get());
     if (exp == 1)
         return MultivariatePolynomial(*this);
-    if (exp == 2)
-        return *this * *this;
-    MultivariatePolynomial<Coeff, Ordering, Policies> res(constant_one<Coeff>::get());
-    MultivariatePolynomial<Coeff, Ordering, Policies> mult(*this);
-    while (exp > 0) {
-#if 0
-		if (exp & 1) res *= mult;
-		exp /= 2;
-		if(exp > 0) mult.square();
-#else
-        res *= mult;
-        exp--;
-#endif
+    if (nrTerms() == 1)
+        return MultivariatePolynomial(lterm().pow(uint(exp)));
+    if (strategy == PowerStrategy::Automatic) {
+        strategy = powerStrategy(exp);
+    }
+    switch (strategy) {
+        case PowerStrategy::Multiplication: {
+            MultivariatePolynomial<Coeff, Ordering, Policies> res(*this);
+            for (std::size_t i = 1; i < exp; ++i) {
+                res *= *this;
+            }
+            return res;
+        }
+        case PowerStrategy::Multinomial:
+            if (exp <= MultinomialMaxExponent && multinomialProducts(exp) <= MultinomialMaxProducts)
+                return multinomialPow(exp);
+            // The expansion is too large.
+            return squaringPow(exp);
+        default:
+            return squaringPow(exp);
     }
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+typename MultivariatePolynomial<Coeff, Ordering, Policies>::PowerStrategy MultivariatePolynomial<Coeff, Ordering, Policies>::powerStrategy(std::size_t exp) const {
+    // Approximate binomial coefficient, large values only have to be compared.
+    auto binomial = [](std::size_t n, std::size_t k) {
+        k = std::min(k, n - k);
+        double res = 1;
+        for (std::size_t i = 1; i <= k; ++i) {
+            res = res * double(n - k + i) / double(i);
+        }
+        return res;
+    };
+    std::set<Variable> vars;
+    gatherVariables(vars);
+    double terms = double(nrTerms());
+    // Estimates the number of terms of the given power by the number of products of powers of the terms and the number of monomials of the
+    // respective degree.
+    auto size = [&](std::size_t e) {
+        return std::min(binomial(e + nrTerms() - 1, nrTerms() - 1), binomial(vars.size() + e * totalDegree(), vars.size()));
+    };
+    // The costs are estimated by the number of term products.
+    double multinomial = binomial(exp + nrTerms() - 1, nrTerms() - 1) * terms;
+    double multiplication = 0;
+    for (std::size_t e = 1; e < exp; ++e) {
+        multiplication += size(e) * terms;
+    }
+    double squaring = 0;
+    std::size_t e = 1;
+    for (std::size_t bit = std::bit_floor(exp) >> 1; bit > 0; bit >>= 1) {
+        squaring += size(e) * size(e) / 2;
+        e *= 2;
+        if (exp & bit) {
+            squaring += size(e) * terms;
+            e += 1;
+        }
+    }
+    if (multinomial <= multiplication && multinomial <= squaring)
+        return PowerStrategy::Multinomial;
+    return (multiplication <= squaring) ? PowerStrategy::Multiplication : PowerStrategy::Squaring;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::squaringPow(std::size_t exp) const {
+    assert(exp > 0);
+    // Process the exponent from the most significant bit, hence we only ever multiply with this polynomial and not with large intermediate powers.
+    MultivariatePolynomial<Coeff, Ordering, Policies> res(*this);
+    for (std::size_t bit = std::bit_floor(exp) >> 1; bit > 0; bit >>= 1) {
+        res *= res;
+        if (exp & bit) {
+            res *= *this;
+        }
+    }
+    return res;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::multinomialPow(std::size_t exp) const {
+    assert(exp > 0);
+    // binomial[n][k] is n choose k. Computed via additions, hence it works for all coefficient types.
+    std::vector<std::vector<Coeff>> binomial(exp + 1);
+    for (std::size_t n = 0; n <= exp; ++n) {
+        binomial[n].reserve(n + 1);
+        binomial[n].push_back(constant_one<Coeff>::get());
+        for (std::size_t k = 1; k < n; ++k) {
+            binomial[n].push_back(binomial[n - 1][k - 1] + binomial[n - 1][k]);
+        }
+        if (n > 0)
+            binomial[n].push_back(constant_one<Coeff>::get());
+    }
+    // powers[j][i] is the i'th power of the j'th term.
+    std::vector<TermsType> powers(mTerms.size());
+    for (std::size_t j = 0; j < mTerms.size(); ++j) {
+        powers[j].reserve(exp + 1);
+        powers[j].emplace_back(constant_one<Coeff>::get());
+        for (std::size_t i = 1; i <= exp; ++i) {
+            powers[j].push_back(powers[j].back() * mTerms[j]);
+        }
+    }
+    auto id = termAdditionManager().getId(multinomialProducts(exp));
+    // Distribute the remaining exponent among the terms j and following.
+    auto expand = [&](auto& self, std::size_t j, std::size_t remaining, const TermType& factor) -> void {
+        if (j + 1 == mTerms.size()) {
+            TermType t = factor * powers[j][remaining];
+            if (!t.isZero())
+                termAdditionManager().template addTerm<false>(id, t);
+            return;
+        }
+        for (std::size_t i = 0; i <= remaining; ++i) {
+            self(self, j + 1, remaining - i, factor * powers[j][i] * binomial[remaining][i]);
+        }
+    };
+    expand(expand, 0, exp, TermType(constant_one<Coeff>::get()));
+    MultivariatePolynomial<Coeff, Ordering, Policies> res;
+    termAdditionManager().readTerms(id, res.mTerms);
+    res.mOrdered = false;
+    res.template makeMinimallyOrdered<false, true>();
+    assert(res.isConsistent());
     return res;
 }
 
+template<typename Coeff, typename Ordering, typename Policies>
+std::size_t MultivariatePolynomial<Coeff, Ordering, Policies>::multinomialProducts(std::size_t exp) const {
+    constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
+    if (exp > max - mTerms.size())
+        return max;
+    // The number of products is exp + nrTerms() - 1 choose nrTerms() - 1, every intermediate value is a binomial coefficient as well.
+    std::size_t products = 1;
+    for (std::size_t j = 1; j < mTerms.size(); ++j) {
+        if (products > max / (exp + j))
+            return max;
+        products = products * (exp + j) / j;
+    }
+    return products;
+}
+
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::naive_pow(unsigned exp) const {
     if (exp == 0) {
@@ -1170,23 +1348,61 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 void MultivariatePolynomial<Coeff, Ordering, Policies>::gatherVariables(std::set<Variable>& vars) const {
-    for (const auto& t : mTerms) {
-        t.gatherVariables(vars);
+    for (const auto& d : variableDegrees()) {
+        vars.insert(d.first);
     }
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
 std::set<Variable> MultivariatePolynomial<Coeff, Ordering, Policies>::gatherVariables() const {
     std::set<Variable> vars;
-    gatherVariables(vars);
+    for (const auto& d : variableDegrees()) {
+        vars.emplace_hint(vars.end(), d.first);
+    }
     return vars;
 }
 
+template<typename Coeff, typename Ordering, typename Policies>
+const std::vector<std::pair<Variable, std::size_t>>& MultivariatePolynomial<Coeff, Ordering, Policies>::variableDegrees() const {
+    auto cached = std::atomic_load(&mVariableDegrees);
+    if (!cached) {
+        auto degrees = std::make_shared<const std::vector<std::pair<Variable, std::size_t>>>(computeVariableDegrees());
+        // If another thread published its result in the meantime, it is kept and stored in cached.
+        if (std::atomic_compare_exchange_strong(&mVariableDegrees, &cached, degrees)) {
+            cached = std::move(degrees);
+        }
+    }
+    return *cached;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+std::vector<std::pair<Variable, std::size_t>> MultivariatePolynomial<Coeff, Ordering, Policies>::computeVariableDegrees() const {
+    std::vector<std::pair<Variable, std::size_t>> degrees;
+    for (const auto& term : mTerms) {
+        if (term.monomial() == nullptr)
+            continue;
+        for (const auto& ve : *term.monomial()) {
+            auto it = std::lower_bound(degrees.begin(), degrees.end(), ve.first, [](const auto& d, Variable::Arg v) { return d.first < v; });
+            if (it == degrees.end() || it->first != ve.first) {
+                degrees.emplace(it, ve.first, ve.second);
+            } else if (it->second < ve.second) {
+                it->second = ve.second;
+            }
+        }
+    }
+    return degrees;
+}
+
 template<typename Coeff, typename Ordering, typename Policies>
 template<bool gatherCoeff>
 VariableInformation<gatherCoeff, MultivariatePolynomial<Coeff, Ordering, Policies>> MultivariatePolynomial<Coeff, Ordering, Policies>::getVarInfo(
     Variable::Arg v) const {
     VariableInformation<gatherCoeff, MultivariatePolynomial> varinfomap;
+    if constexpr (!gatherCoeff) {
+        // Without coefficients, nothing is collected for a variable that does not occur.
+        if (!has(v))
+            return varinfomap;
+    }
     // We iterate over all terms.
     for (const auto& term : mTerms) {
         // And gather information from the terms and meanwhile up
@@ -1222,23 +1438,27 @@ UnivariatePolynomial<C> MultivariatePolynomial<C, O, P>::toUnivariatePolynomial(
 template<typename C, typename O, typename P>
 UnivariatePolynomial<MultivariatePolynomial<C, O, P>> MultivariatePolynomial<C, O, P>::toUnivariatePolynomial(Variable::Arg v) const {
     assert(this->isConsistent());
-    std::vector<MultivariatePolynomial<C, O, P>> coeffs(1);
+    // Terms with distinct monomials stay distinct when v is dropped, hence the terms of every coefficient can be collected without merging.
+    std::vector<TermsType> terms(1);
     for (const auto& term : this->mTerms) {
-        if (term.monomial() == nullptr)
-            coeffs[0] += term;
-        else {
-            auto mon = term.monomial();
-            auto exponent = mon->exponentOfVariable(v);
-            if (exponent >= coeffs.size()) {
-                coeffs.resize(exponent + 1);
-            }
-            std::shared_ptr<const carl::Monomial> tmp = mon->dropVariable(v);
-            coeffs[exponent] += term.coeff() * tmp;
+        exponent e = term.monomial() == nullptr ? 0 : term.monomial()->exponentOfVariable(v);
+        if (e >= terms.size()) {
+            terms.resize(e + 1);
+        }
+        if (e == 0) {
+            terms[0].push_back(term);
+        } else {
+            terms[e].emplace_back(term.coeff(), term.monomial()->dropVariable(v));
         }
     }
+    std::vector<MultivariatePolynomial<C, O, P>> coeffs;
+    coeffs.reserve(terms.size());
+    for (auto& t : terms) {
+        coeffs.emplace_back(std::move(t), false, false);
+    }
     // Convert result back to MultivariatePolynomial and check that the result is equal to *this
     assert(MultivariatePolynomial<C>(UnivariatePolynomial<MultivariatePolynomial<C, O, P>>(v, coeffs)) == *this);
-    return UnivariatePolynomial<MultivariatePolynomial<C, O, P>>(v, coeffs);
+    return UnivariatePolynomial<MultivariatePolynomial<C, O, P>>(v, std::move(coeffs));
 }
 
 template<typename Coeff, typename O, typename P>
@@ -1469,6 +1689,7 @@ bool operator<(const C& lhs, const MultivariatePolynomial<C, O, P>& rhs) {
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator+=(const MultivariatePolynomial& rhs) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
     assert(rhs.isConsistent());
     if (mTerms.empty()) {
@@ -1501,14 +1722,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         mTerms.pop_back();
         --rhsEnd;
     }
-    auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size() + rhs.mTerms.size());
     for (auto termIter = mTerms.begin(); termIter != mTerms.end(); ++termIter) {
-        mTermAdditionManager.template addTerm<false, false>(id, *termIter);
+        termAdditionManager().template addTerm<false, false>(id, *termIter);
     }
     for (auto termIter = rhs.mTerms.begin(); termIter != rhsEnd; ++termIter) {
-        mTermAdditionManager.template addTerm<false, false>(id, *termIter);
+        termAdditionManager().template addTerm<false, false>(id, *termIter);
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     if (newlterm.isZero()) {
         makeMinimallyOrdered<false, true>();
     } else {
@@ -1527,6 +1748,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator+=(const TermType& rhs) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
     if (carl::isZero(rhs.coeff()))
         return *this;
@@ -1566,12 +1788,12 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         mTerms.push_back(rhs);
     } else {
         // Full-blown addition.
-        auto id = mTermAdditionManager.getId(mTerms.size() + 1);
+        auto id = termAdditionManager().getId(mTerms.size() + 1);
         for (const auto& term : mTerms) {
-            mTermAdditionManager.template addTerm<false>(id, term);
+            termAdditionManager().template addTerm<false>(id, term);
         }
-        mTermAdditionManager.template addTerm<false>(id, rhs);
-        mTermAdditionManager.readTerms(id, mTerms);
+        termAdditionManager().template addTerm<false>(id, rhs);
+        termAdditionManager().readTerms(id, mTerms);
         makeMinimallyOrdered<false, true>();
         mOrdered = false;
     }
@@ -1581,6 +1803,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator+=(const Monomial::Arg& rhs) {
+    mVariableDegrees.reset();
     if (mTerms.empty()) {
         // Empty -> just insert.
         mTerms.emplace_back(constant_one<Coeff>::get(), rhs);
@@ -1623,11 +1846,13 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator+=(Variable::Arg rhs) {
+    mVariableDegrees.reset();
     return *this += MonomialPool::getInstance().create(rhs, 1);
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator+=(const Coeff& rhs) {
+    mVariableDegrees.reset();
     if (carl::isZero(rhs))
         return *this;
     if (hasConstantTerm()) {
@@ -1663,7 +1888,7 @@ MultivariatePolynomial<C, O, P> operator+(const MultivariatePolynomial<C, O, P>&
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
-MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::operator-() const {
+MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::operator-() const& {
     assert(this->isConsistent());
     MultivariatePolynomial<Coeff, Ordering, Policies> negation;
     negation.mTerms.reserve(mTerms.size());
@@ -1675,8 +1900,18 @@ MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff,
     return negation;
 }
 
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::operator-() && {
+    assert(this->isConsistent());
+    for (auto& term : mTerms) {
+        term.negate();
+    }
+    return std::move(*this);
+}
+
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator-=(const MultivariatePolynomial& rhs) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
     assert(rhs.isConsistent());
     if (mTerms.empty()) {
@@ -1695,14 +1930,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         return *this += c;
     }
 
-    auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+    auto id = termAdditionManager().getId(mTerms.size() + rhs.mTerms.size());
     for (const auto& term : mTerms) {
-        mTermAdditionManager.template addTerm<false>(id, term);
+        termAdditionManager().template addTerm<false>(id, term);
     }
     for (const auto& term : rhs.mTerms) {
-        mTermAdditionManager.template addTerm<false>(id, -term);
+        termAdditionManager().template addTerm<false>(id, -term);
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     mOrdered = false;
     makeMinimallyOrdered<false, true>();
     assert(this->isConsistent());
@@ -1711,6 +1946,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator-=(const Term<Coeff>& rhs) {
+    mVariableDegrees.reset();
     ///@todo Check if this works with ordering.
     if (carl::isZero(rhs.coeff()))
         return *this;
@@ -1756,6 +1992,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator-=(const Monomial::Arg& rhs) {
+    mVariableDegrees.reset();
     ///@todo Check if this works with ordering.
     if (!rhs) {
         *this -= constant_one<Coeff>::get();
@@ -1800,17 +2037,27 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator-=(Variable::Arg rhs) {
+    mVariableDegrees.reset();
     return *this += Term<Coeff>(-carl::constant_one<Coeff>().get(), rhs, 1);
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator-=(const Coeff& rhs) {
+    mVariableDegrees.reset();
     return *this += (-rhs);
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator*=(
     const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs) {
+    mVariableDegrees.reset();
+    return multiply(rhs, MultiplicationStrategy::Automatic);
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::multiply(
+    const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs, MultiplicationStrategy strategy) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
     assert(rhs.isConsistent());
     if (mTerms.empty())
@@ -1831,7 +2078,82 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         *this = rhs;
         return *this *= c;
     }
-    auto id = mTermAdditionManager.getId(mTerms.size() * rhs.mTerms.size());
+    if (strategy == MultiplicationStrategy::Automatic) {
+        strategy = multiplicationStrategy(mTerms.size(), rhs.mTerms.size());
+    }
+    switch (strategy) {
+        case MultiplicationStrategy::Heap:
+            multiplyByHeap(rhs);
+            break;
+        case MultiplicationStrategy::Geobucket:
+            multiplyByGeobucket(rhs);
+            break;
+        case MultiplicationStrategy::Kronecker:
+            if (multiplyByKronecker(rhs)) {
+                break;
+            }
+            if (mTerms.size() * rhs.mTerms.size() > TermAdditionMaxProducts) {
+                multiplyByHeap(rhs);
+                break;
+            }
+            [[fallthrough]];
+        default:
+            multiplyByTermAddition(rhs);
+    }
+    assert(this->isConsistent());
+    return *this;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+typename MultivariatePolynomial<Coeff, Ordering, Policies>::MultiplicationStrategy MultivariatePolynomial<Coeff, Ordering, Policies>::multiplicationStrategy(
+    std::size_t lhsTerms, std::size_t rhsTerms) {
+    // Kronecker substitution is much faster for all but the smallest dense products of GMP numbers and falls back to the other algorithms
+    // for sparse products.
+    if constexpr (std::is_same<Coeff, mpz_class>::value || std::is_same<Coeff, mpq_class>::value) {
+        if (lhsTerms * rhsTerms >= KroneckerMinProducts)
+            return MultiplicationStrategy::Kronecker;
+    }
+    // The term addition manager is fastest as long as there are only few products.
+    // Otherwise, the heap is faster than the term addition manager (even without sorting the result) and the geobucket, as it neither
+    // needs a table indexed by monomial ids nor has to copy terms between buckets.
+    if (lhsTerms * rhsTerms <= TermAdditionMaxProducts)
+        return MultiplicationStrategy::TermAddition;
+    return MultiplicationStrategy::Heap;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+typename MultivariatePolynomial<Coeff, Ordering, Policies>::TermsType MultivariatePolynomial<Coeff, Ordering, Policies>::mergeTerms(
+    TermsType&& lhs, TermsType&& rhs) {
+    TermsType res;
+    res.reserve(lhs.size() + rhs.size());
+    auto l = lhs.begin();
+    auto r = rhs.begin();
+    while (l != lhs.end() && r != rhs.end()) {
+        switch (OrderedBy::compare(*l, *r)) {
+            case CompareResult::LESS:
+                res.push_back(std::move(*l++));
+                break;
+            case CompareResult::GREATER:
+                res.push_back(std::move(*r++));
+                break;
+            case CompareResult::EQUAL: {
+                Coeff c = l->coeff() + r->coeff();
+                if (!carl::isZero(c)) {
+                    res.emplace_back(std::move(c), l->monomial());
+                }
+                ++l;
+                ++r;
+            }
+        }
+    }
+    res.insert(res.end(), std::make_move_iterator(l), std::make_move_iterator(lhs.end()));
+    res.insert(res.end(), std::make_move_iterator(r), std::make_move_iterator(rhs.end()));
+    return res;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::multiplyByTermAddition(const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs) {
+    auto id = termAdditionManager().getId(mTerms.size() * rhs.mTerms.size());
     TermType newlterm;
     bool first = true;
     for (auto t1 = mTerms.rbegin(); t1 != mTerms.rend(); t1++) {
@@ -1840,60 +2162,245 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
                 newlterm = *t1 * *t2;
                 first = false;
             } else
-                mTermAdditionManager.template addTerm<false>(id, std::move((*t1) * (*t2)));
+                termAdditionManager().template addTerm<false>(id, std::move((*t1) * (*t2)));
         }
     }
-    mTermAdditionManager.readTerms(id, mTerms);
+    termAdditionManager().readTerms(id, mTerms);
     if (newlterm.isZero())
         makeMinimallyOrdered<false, true>();
     else
         mTerms.push_back(newlterm);
     // makeMinimallyOrdered<false, true>();
     mOrdered = false;
-    assert(this->isConsistent());
-    return *this;
 }
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::multiplyByHeap(const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs) {
+    makeOrdered();
+    rhs.makeOrdered();
+    // Rows are indexed by the smaller operand, columns by the larger one, both starting at the leading term.
+    const TermsType& rows = (mTerms.size() <= rhs.mTerms.size()) ? mTerms : rhs.mTerms;
+    const TermsType& cols = (mTerms.size() <= rhs.mTerms.size()) ? rhs.mTerms : mTerms;
+    struct Entry {
+        Monomial::Arg monomial;
+        std::size_t row;
+        std::size_t col;
+    };
+    auto product = [&](std::size_t row, std::size_t col) {
+        return Entry{rows[rows.size() - 1 - row].monomial() * cols[cols.size() - 1 - col].monomial(), row, col};
+    };
+    auto heapLess = [](const Entry& lhs, const Entry& rhs) { return OrderedBy::less(lhs.monomial, rhs.monomial); };
+    // Every row has at most one entry in the heap. The entry of row i+1 is only inserted once column zero of row i has been processed.
+    std::vector<Entry> heap;
+    heap.reserve(rows.size());
+    heap.push_back(product(0, 0));
+    TermsType res;
+    res.reserve(rows.size() + cols.size());
+    while (!heap.empty()) {
+        Monomial::Arg monomial = heap.front().monomial;
+        Coeff coeff = constant_zero<Coeff>::get();
+        do {
+            std::pop_heap(heap.begin(), heap.end(), heapLess);
+            Entry& e = heap.back();
+            coeff += rows[rows.size() - 1 - e.row].coeff() * cols[cols.size() - 1 - e.col].coeff();
+            if (e.col == 0 && e.row + 1 < rows.size()) {
+                Entry next = product(e.row + 1, 0);
+                if (e.col + 1 < cols.size()) {
+                    e = product(e.row, e.col + 1);
+                    std::push_heap(heap.begin(), heap.end(), heapLess);
+                } else {
+                    heap.pop_back();
+                }
+                heap.push_back(std::move(next));
+                std::push_heap(heap.begin(), heap.end(), heapLess);
+            } else if (e.col + 1 < cols.size()) {
+                e = product(e.row, e.col + 1);
+                std::push_heap(heap.begin(), heap.end(), heapLess);
+            } else {
+                heap.pop_back();
+            }
+        } while (!heap.empty() && heap.front().monomial == monomial);
+        if (!carl::isZero(coeff)) {
+            res.emplace_back(std::move(coeff), std::move(monomial));
+        }
+    }
+    std::reverse(res.begin(), res.end());
+    mTerms = std::move(res);
+    mOrdered = true;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+void MultivariatePolynomial<Coeff, Ordering, Policies>::multiplyByGeobucket(const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs) {
+    makeOrdered();
+    rhs.makeOrdered();
+    const TermsType& rows = (mTerms.size() <= rhs.mTerms.size()) ? mTerms : rhs.mTerms;
+    const TermsType& cols = (mTerms.size() <= rhs.mTerms.size()) ? rhs.mTerms : mTerms;
+    // Bucket i holds at most cols.size() * 4^(i+1) terms, hence every term is merged a logarithmic number of times.
+    std::vector<TermsType> buckets;
+    for (const auto& r : rows) {
+        TermsType row;
+        row.reserve(cols.size());
+        for (const auto& c : cols) {
+            TermType t = r * c;
+            if (!t.isZero()) {
+                row.push_back(std::move(t));
+            }
+        }
+        std::size_t capacity = cols.size();
+        for (std::size_t i = 0;; ++i) {
+            capacity *= 4;
+            if (i == buckets.size()) {
+                buckets.push_back(std::move(row));
+                break;
+            }
+            row = mergeTerms(std::move(buckets[i]), std::move(row));
+            if (row.size() <= capacity) {
+                buckets[i] = std::move(row);
+                break;
+            }
+            buckets[i].clear();
+        }
+    }
+    TermsType res;
+    for (auto& b : buckets) {
+        res = mergeTerms(std::move(res), std::move(b));
+    }
+    mTerms = std::move(res);
+    mOrdered = true;
+}
+
+template<typename Coeff, typename Ordering, typename Policies>
+bool MultivariatePolynomial<Coeff, Ordering, Policies>::multiplyByKronecker(const MultivariatePolynomial<Coeff, Ordering, Policies>& rhs) {
+    if constexpr (std::is_same<Coeff, mpz_class>::value || std::is_same<Coeff, mpq_class>::value) {
+        // The radix of a variable exceeds its degree in the product, hence the exponents of different variables do not interfere.
+        std::map<Variable, std::size_t> radix;
+        for (const auto* p : {static_cast<const MultivariatePolynomial*>(this), &rhs}) {
+            std::map<Variable, std::size_t> degrees;
+            for (const auto& term : p->mTerms) {
+                if (term.monomial() == nullptr)
+                    continue;
+                for (const auto& ve : *term.monomial()) {
+                    std::size_t& d = degrees[ve.first];
+                    d = std::max(d, std::size_t(ve.second));
+                }
+            }
+            for (const auto& d : degrees) {
+                radix[d.first] += d.second;
+            }
+        }
+        std::size_t maxSlots = KroneckerDensity * mTerms.size() * rhs.mTerms.size();
+        std::vector<std::pair<Variable, std::size_t>> strides;
+        std::size_t slots = 1;
+        for (auto& r : radix) {
+            r.second += 1;
+            strides.emplace_back(r.first, slots);
+            if (slots > maxSlots / r.second)
+                return false;
+            slots *= r.second;
+        }
+        // Substitutes the variables and scales the coefficients to integers. The polynomial is divided by the resulting denominator.
+        auto substitute = [&strides](const MultivariatePolynomial& p, mpz_class& denominator) {
+            denominator = 1;
+            if constexpr (std::is_same<Coeff, mpq_class>::value) {
+                for (const auto& term : p.mTerms) {
+                    denominator = carl::lcm(denominator, getDenom(term.coeff()));
+                }
+            }
+            SparseIntegerPolynomial res;
+            res.reserve(p.mTerms.size());
+            for (const auto& term : p.mTerms) {
+                std::size_t index = 0;
+                if (term.monomial() != nullptr) {
+                    for (const auto& ve : *term.monomial()) {
+                        auto it = std::find_if(strides.begin(), strides.end(), [&ve](const auto& s) { return s.first == ve.first; });
+                        index += ve.second * it->second;
+                    }
+                }
+                if constexpr (std::is_same<Coeff, mpq_class>::value) {
+                    res.emplace_back(index, getNum(term.coeff()) * (denominator / getDenom(term.coeff())));
+                } else {
+                    res.emplace_back(index, term.coeff());
+                }
+            }
+            return res;
+        };
+        mpz_class lhsDenominator;
+        mpz_class rhsDenominator;
+        SparseIntegerPolynomial product = kroneckerMultiply(substitute(*this, lhsDenominator), substitute(rhs, rhsDenominator));
+        mpz_class denominator = lhsDenominator * rhsDenominator;
+        TermsType terms;
+        terms.reserve(product.size());
+        for (auto& c : product) {
+            Monomial::Content content;
+            exponent tdeg = 0;
+            std::size_t index = c.first;
+            for (const auto& r : radix) {
+                auto e = exponent(index % r.second);
+                index /= r.second;
+                if (e > 0) {
+                    content.emplace_back(r.first, e);
+                    tdeg += e;
+                }
+            }
+            Monomial::Arg monomial = content.empty() ? nullptr : createMonomial(std::move(content), tdeg);
+            if constexpr (std::is_same<Coeff, mpq_class>::value) {
+                Coeff coeff(c.second, denominator);
+                coeff.canonicalize();
+                terms.emplace_back(std::move(coeff), std::move(monomial));
+            } else {
+                terms.emplace_back(std::move(c.second), std::move(monomial));
+            }
+        }
+        mTerms = std::move(terms);
+        mOrdered = false;
+        makeMinimallyOrdered();
+        return true;
+    } else {
+        return false;
+    }
+}
+
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator*=(const Term<Coeff>& rhs) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
-    ///@todo more efficient.
-    TermsType newTerms;
-    newTerms.reserve(mTerms.size());
-    for (const auto& term : mTerms) {
-        newTerms.push_back(term * rhs);
+    if (carl::isZero(rhs.coeff())) {
+        mTerms.clear();
+        assert(this->isConsistent());
+        return *this;
+    }
+    // Multiplying all terms with the same term retains the order of the terms.
+    for (auto& term : mTerms) {
+        term *= rhs;
     }
-    mTerms = std::move(newTerms);
     assert(this->isConsistent());
     return *this;
 }
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator*=(const Monomial::Arg& rhs) {
+    mVariableDegrees.reset();
     assert(this->isConsistent());
-    ///@todo more efficient.
-    TermsType newTerms;
-    newTerms.reserve(mTerms.size());
-    for (const auto& term : mTerms) {
-        newTerms.push_back(term * rhs);
+    if (rhs == nullptr)
+        return *this;
+    for (auto& term : mTerms) {
+        term *= rhs;
     }
-    mTerms = std::move(newTerms);
     assert(this->isConsistent());
     return *this;
 }
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator*=(Variable::Arg rhs) {
-    ///@todo more efficient.
-    TermsType newTerms;
-    newTerms.reserve(mTerms.size());
-    for (const auto& term : mTerms) {
-        newTerms.push_back(term * rhs);
+    mVariableDegrees.reset();
+    assert(this->isConsistent());
+    for (auto& term : mTerms) {
+        term *= rhs;
     }
-    mTerms = std::move(newTerms);
     assert(this->isConsistent());
     return *this;
 }
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator*=(const Coeff& rhs) {
-    ///@todo more efficient.
+    mVariableDegrees.reset();
     if (carl::isOne(rhs))
         return *this;
     if (carl::isZero(rhs)) {
@@ -1901,12 +2408,9 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         assert(this->isConsistent());
         return *this;
     }
-    TermsType newTerms;
-    newTerms.reserve(mTerms.size());
-    for (const auto& term : mTerms) {
-        newTerms.push_back(term * rhs);
+    for (auto& term : mTerms) {
+        term.coeff() *= rhs;
     }
-    mTerms = std::move(newTerms);
     assert(this->isConsistent());
     return *this;
 }
@@ -1921,6 +2425,7 @@ const MultivariatePolynomial<C, O, P> operator*(const MultivariatePolynomial<C,
 }
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff, Ordering, Policies>::operator/=(const Coeff& rhs) {
+    mVariableDegrees.reset();
     assert(!carl::isZero(rhs));
     if (carl::isOne(rhs))
         return *this;
@@ -2063,6 +2568,10 @@ bool MultivariatePolynomial<Coeff, Ordering, Policies>::isConsistent() const {
             }
         }
     }
+    if (auto cached = std::atomic_load(&mVariableDegrees)) {
+        // The cached variables must match the terms.
+        assert(*cached == computeVariableDegrees());
+    }
     return true;
 }
 
@@ -0,0 +1,195 @@
+/**
+ * @file PackedExponents.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+#include "CompareResult.h"
+#include "Variable.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace carl {
+
+/**
+ * Dense representation of the exponents of a monomial in the variables with the smallest ids.
+ *
+ * The exponent of the variable with id i is stored in byte i-1 of two 64 bit words, hence the variables with the ids 1 to 16 can be represented.
+ * Variable ids are only unique within a variable type, hence only real variables are packed.
+ * A monomial is packed if it only contains such variables (of rank zero) and all exponents are smaller than 128.
+ * As the most significant bit of every byte is unused, divisibility, lcm, gcd and the lexical comparison can be computed on whole words.
+ * Otherwise, the representation is empty and the sparse representation of the monomial has to be used.
+ *
+ * If SSE2 is available, both words are processed as a single vector register. SSE2 is part of every x86-64 target, hence this does not depend on
+ * hardware-specific compiler flags and is also used in portable builds.
+ */
+class PackedExponents {
+   public:
+    /// Number of variables that can be represented.
+    static constexpr std::size_t Slots = 16;
+    /// Largest exponent that can be represented.
+    static constexpr uint MaxExponent = 127;
+
+   private:
+    static constexpr std::uint64_t HighBits = 0x8080808080808080ull;
+    /// Exponents, one byte per variable.
+    std::array<std::uint64_t, 2> mWords = {0, 0};
+    /// Bit i is set if the variable with id i+1 occurs.
+    std::uint16_t mVariables = 0;
+
+    /**
+     * Computes a mask with all bits of a byte set if the byte in lhs is at least as large as the byte in rhs.
+     */
+#ifdef __SSE2__
+    static __m128i load(const PackedExponents& p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.mWords.data()));
+    }
+    void store(__m128i v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mWords.data()), v);
+    }
+#else
+    static std::uint64_t greaterEqualMask(std::uint64_t lhs, std::uint64_t rhs) {
+        // No byte can borrow from its neighbour, as all exponents are smaller than 128.
+        return ((((lhs | HighBits) - rhs) & HighBits) >> 7) * 0xFFu;
+    }
+#endif
+
+   public:
+    PackedExponents() = default;
+
+    /**
+     * Packs the given exponents, if possible.
+     * @param content Exponents sorted by variables.
+     * @return Packed exponents, empty if the exponents can not be packed.
+     */
+    static PackedExponents pack(const std::vector<std::pair<Variable, uint>>& content) {
+        PackedExponents res;
+        for (const auto& ve : content) {
+            if (ve.first.type() != VariableType::VT_REAL || ve.first.rank() != 0 || ve.first.id() > Slots || ve.second > MaxExponent) {
+                return PackedExponents();
+            }
+            std::size_t slot = ve.first.id() - 1;
+            res.mWords[slot / 8] |= static_cast<std::uint64_t>(ve.second) << (8 * (slot % 8));
+            res.mVariables = static_cast<std::uint16_t>(res.mVariables | (1u << slot));
+        }
+        return res;
+    }
+
+    /**
+     * @return If the exponents of the monomial are packed.
+     */
+    bool packed() const {
+        return mVariables != 0;
+    }
+    /**
+     * @return Bit mask of the variables, bit i corresponding to the variable with id i+1.
+     */
+    std::uint16_t variables() const {
+        return mVariables;
+    }
+    /**
+     * @param slot Slot, i.e. variable id minus one.
+     * @return Exponent of the variable in the given slot.
+     */
+    uint exponent(std::size_t slot) const {
+        return (mWords[slot / 8] >> (8 * (slot % 8))) & 0xFFu;
+    }
+
+    friend bool operator==(const PackedExponents& lhs, const PackedExponents& rhs) {
+        return lhs.mWords == rhs.mWords;
+    }
+
+    /**
+     * Checks whether lhs is divisible by rhs, both must be packed.
+     */
+    static bool divisible(const PackedExponents& lhs, const PackedExponents& rhs) {
+#ifdef __SSE2__
+        __m128i l = load(lhs);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(l, load(rhs)), l)) == 0xFFFF;
+#else
+        return (((lhs.mWords[0] | HighBits) - rhs.mWords[0]) & ((lhs.mWords[1] | HighBits) - rhs.mWords[1]) & HighBits) == HighBits;
+#endif
+    }
+
+    /**
+     * Computes the exponents of the lcm of lhs and rhs, both must be packed.
+     */
+    static PackedExponents lcm(const PackedExponents& lhs, const PackedExponents& rhs) {
+        PackedExponents res;
+#ifdef __SSE2__
+        res.store(_mm_max_epu8(load(lhs), load(rhs)));
+#else
+        for (std::size_t i = 0; i < 2; ++i) {
+            std::uint64_t mask = greaterEqualMask(lhs.mWords[i], rhs.mWords[i]);
+            res.mWords[i] = (lhs.mWords[i] & mask) | (rhs.mWords[i] & ~mask);
+        }
+#endif
+        res.mVariables = lhs.mVariables | rhs.mVariables;
+        return res;
+    }
+
+    /**
+     * Computes the exponents of the gcd of lhs and rhs, both must be packed.
+     * The result is empty if the gcd is constant.
+     */
+    static PackedExponents gcd(const PackedExponents& lhs, const PackedExponents& rhs) {
+        PackedExponents res;
+#ifdef __SSE2__
+        res.store(_mm_min_epu8(load(lhs), load(rhs)));
+#else
+        for (std::size_t i = 0; i < 2; ++i) {
+            std::uint64_t mask = greaterEqualMask(lhs.mWords[i], rhs.mWords[i]);
+            res.mWords[i] = (rhs.mWords[i] & mask) | (lhs.mWords[i] & ~mask);
+        }
+#endif
+        res.mVariables = lhs.mVariables & rhs.mVariables;
+        return res;
+    }
+
+    /**
+     * Lexical comparison of lhs and rhs, both must be packed.
+     * Yields the same result as Monomial::lexicalCompare() for the corresponding monomials.
+     */
+    static CompareResult lexicalCompare(const PackedExponents& lhs, const PackedExponents& rhs) {
+        // The first variable whose exponents differ decides.
+#ifdef __SSE2__
+        unsigned diff = ~unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(load(lhs), load(rhs)))) & 0xFFFFu;
+        if (diff == 0)
+            return CompareResult::EQUAL;
+        std::size_t slot = std::size_t(std::countr_zero(diff));
+#else
+        std::size_t slot = Slots;
+        for (std::size_t i = 0; i < 2; ++i) {
+            std::uint64_t diff = lhs.mWords[i] ^ rhs.mWords[i];
+            if (diff != 0) {
+                slot = i * 8 + std::size_t(std::countr_zero(diff)) / 8;
+                break;
+            }
+        }
+        if (slot == Slots)
+            return CompareResult::EQUAL;
+#endif
+        uint l = lhs.exponent(slot);
+        uint r = rhs.exponent(slot);
+        if (l != 0 && r != 0) {
+            return (l > r) ? CompareResult::LESS : CompareResult::GREATER;
+        }
+        std::uint16_t larger = static_cast<std::uint16_t>(~((2u << slot) - 1));
+        if (r == 0) {
+            return (rhs.mVariables & larger) ? CompareResult::LESS : CompareResult::GREATER;
+        }
+        return (lhs.mVariables & larger) ? CompareResult::GREATER : CompareResult::LESS;
+    }
+};
+
+}  // namespace carl
@@ -0,0 +1,210 @@
+/**
+ * @file PolynomialPool.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../config.h"
+#include "../util/IDPool.h"
+#include "../util/Singleton.h"
+#include "logging.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace carl {
+
+template<typename Pol>
+class PolynomialPool;
+
+/**
+ * Handle of a polynomial that is stored in a PolynomialPool.
+ * All handles of equal polynomials refer to the same pooled polynomial, hence they are compared by pointer and their hash is computed only
+ * once when the polynomial is added to the pool. This makes them cheap keys for caches, for example of resultants or factorizations.
+ * The pooled polynomial is immutable.
+ */
+template<typename Pol>
+class PooledPolynomial {
+    friend class PolynomialPool<Pol>;
+
+   private:
+    struct Content {
+        Pol polynomial;
+        std::size_t hash;
+        std::size_t id;
+        Content(Pol&& p, std::size_t h, std::size_t i) : polynomial(std::move(p)), hash(h), id(i) {}
+    };
+    std::shared_ptr<const Content> mContent;
+
+    explicit PooledPolynomial(std::shared_ptr<const Content> content) : mContent(std::move(content)) {}
+
+   public:
+    /**
+     * Adds the given polynomial to the pool.
+     * @param p Polynomial.
+     */
+    explicit PooledPolynomial(const Pol& p) : PooledPolynomial(PolynomialPool<Pol>::getInstance().create(p)) {}
+    explicit PooledPolynomial(Pol&& p) : PooledPolynomial(PolynomialPool<Pol>::getInstance().create(std::move(p))) {}
+    /**
+     * Creates a handle of the zero polynomial.
+     */
+    PooledPolynomial() : PooledPolynomial(Pol()) {}
+
+    const Pol& polynomial() const {
+        return mContent->polynomial;
+    }
+    const Pol& operator*() const {
+        return mContent->polynomial;
+    }
+    const Pol* operator->() const {
+        return &mContent->polynomial;
+    }
+    /**
+     * @return Hash of the polynomial, as computed by std::hash<Pol>.
+     */
+    std::size_t hash() const {
+        return mContent->hash;
+    }
+    /**
+     * @return Id of the polynomial, which is unique among all polynomials in the pool.
+     */
+    std::size_t id() const {
+        return mContent->id;
+    }
+
+    friend bool operator==(const PooledPolynomial& lhs, const PooledPolynomial& rhs) {
+        return lhs.mContent == rhs.mContent;
+    }
+    friend bool operator!=(const PooledPolynomial& lhs, const PooledPolynomial& rhs) {
+        return lhs.mContent != rhs.mContent;
+    }
+    /**
+     * Orders pooled polynomials by their ids. This order is cheap but depends on the order in which the polynomials were created.
+     */
+    friend bool operator<(const PooledPolynomial& lhs, const PooledPolynomial& rhs) {
+        return lhs.id() < rhs.id();
+    }
+    friend std::ostream& operator<<(std::ostream& os, const PooledPolynomial& p) {
+        return os << p.polynomial();
+    }
+};
+
+/**
+ * Pool that stores every polynomial only once, see PooledPolynomial.
+ * Like the MonomialPool without CARL_PRUNE_MONOMIAL_POOL, the pool owns its polynomials until they are reclaimed by collect().
+ */
+template<typename Pol>
+class PolynomialPool : public Singleton<PolynomialPool<Pol>> {
+    friend Singleton<PolynomialPool>;
+
+   private:
+    using Content = typename PooledPolynomial<Pol>::Content;
+
+    /// id allocator
+    IDPool mIDs;
+    /// The polynomials of the pool, indexed by their hashes.
+    std::unordered_multimap<std::size_t, std::shared_ptr<const Content>> mPool;
+    /// Mutex to avoid multiple access to the pool
+    mutable std::recursive_mutex mMutex;
+    /// Number of requests that were answered with an existing polynomial.
+    std::atomic<std::size_t> mHits = 0;
+
+    /**
+     * Locks the pool. Without CARL_THREAD_SAFE, nothing is locked.
+     * @return Lock of the pool.
+     */
+    std::unique_lock<std::recursive_mutex> lockPool() const {
+#ifdef CARL_THREAD_SAFE
+        return std::unique_lock<std::recursive_mutex>(mMutex);
+#else
+        return std::unique_lock<std::recursive_mutex>();
+#endif
+    }
+
+    template<typename P>
+    PooledPolynomial<Pol> add(P&& p) {
+        std::size_t hash = std::hash<Pol>()(p);
+        auto lock = lockPool();
+        auto range = mPool.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->polynomial == p) {
+                ++mHits;
+                return PooledPolynomial<Pol>(it->second);
+            }
+        }
+        auto content = std::make_shared<const Content>(Pol(std::forward<P>(p)), hash, mIDs.get());
+        mPool.emplace(hash, content);
+        return PooledPolynomial<Pol>(std::move(content));
+    }
+
+   protected:
+    PolynomialPool() = default;
+
+   public:
+    /**
+     * Returns the pooled polynomial that is equal to the given polynomial, and adds it to the pool if necessary.
+     * @param p Polynomial.
+     * @return Handle of the pooled polynomial.
+     */
+    PooledPolynomial<Pol> create(const Pol& p) {
+        return add(p);
+    }
+    PooledPolynomial<Pol> create(Pol&& p) {
+        return add(std::move(p));
+    }
+
+    /**
+     * Removes all polynomials that are only referenced by the pool and releases their ids.
+     * Must not be called while other threads create polynomials.
+     * @return Number of polynomials that were reclaimed.
+     */
+    std::size_t collect() {
+        auto lock = lockPool();
+        std::size_t res = 0;
+        for (auto it = mPool.begin(); it != mPool.end();) {
+            if (it->second.use_count() == 1) {
+                mIDs.free(it->second->id);
+                it = mPool.erase(it);
+                ++res;
+            } else {
+                ++it;
+            }
+        }
+        CARL_LOG_DEBUG("carl.pool", "Reclaimed " << res << " polynomials");
+        return res;
+    }
+
+    /**
+     * @return Number of polynomials in the pool.
+     */
+    std::size_t size() const {
+        auto lock = lockPool();
+        return mPool.size();
+    }
+    /**
+     * @return Number of requests that were answered with an existing polynomial.
+     */
+    std::size_t hits() const {
+        return mHits;
+    }
+};
+
+}  // namespace carl
+
+namespace std {
+
+/**
+ * Specialization of `std::hash` for pooled polynomials, which returns the cached hash.
+ */
+template<typename Pol>
+struct hash<carl::PooledPolynomial<Pol>> {
+    std::size_t operator()(const carl::PooledPolynomial<Pol>& p) const {
+        return p.hash();
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,125 @@
+/**
+ * @file SturmSequence.h
+ */
+
+#pragma once
+
+#include "../interval/Interval.h"
+#include "../numbers/numbers.h"
+#include "Sign.h"
+#include "UnivariatePolynomial.h"
+
+#include <algorithm>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A Sturm sequence, or more generally a signed remainder sequence, of a univariate polynomial.
+ * The sequence is computed once and can then be evaluated at arbitrarily many points. The number of real roots of the first polynomial
+ * within an interval is the difference of the sign variations at the bounds.
+ *
+ * For rational coefficients, every element is additionally stored as a primitive integer polynomial, which is a positive multiple of the
+ * element and hence has the same signs. At a point a/b, the powers of a and b are computed once and shared by all elements, and only integer
+ * arithmetic is used.
+ * The sequence is immutable once computed and may be evaluated from several threads at once.
+ */
+template<typename Coeff>
+class SturmSequence {
+    using Polynomial = UnivariatePolynomial<Coeff>;
+    static constexpr bool IntegralEvaluation = std::is_same<Coeff, mpq_class>::value;
+
+    std::vector<Polynomial> mSequence;
+    /// Primitive integer multiples of the elements, only used for rational coefficients.
+    std::vector<UnivariatePolynomial<mpz_class>> mIntegralSequence;
+    /// Maximal degree of the elements.
+    std::size_t mDegree = 0;
+
+   public:
+    /**
+     * Computes the standard Sturm sequence of p, that is the signed remainder sequence of p and its derivative.
+     * @param p Polynomial.
+     */
+    explicit SturmSequence(const Polynomial& p) : SturmSequence(p.standardSturmSequence()) {}
+
+    /**
+     * Computes the signed remainder sequence of p and q.
+     * @param p First polynomial.
+     * @param q Second polynomial.
+     */
+    SturmSequence(const Polynomial& p, const Polynomial& q) : SturmSequence(p.standardSturmSequence(q)) {}
+
+    /**
+     * Wraps an already computed sequence.
+     * @param seq Signed remainder sequence.
+     */
+    explicit SturmSequence(const std::list<Polynomial>& seq) : mSequence(seq.begin(), seq.end()) {
+        for (const Polynomial& p : mSequence) {
+            if (!p.isZero())
+                mDegree = std::max(mDegree, std::size_t(p.degree()));
+        }
+        if constexpr (IntegralEvaluation) {
+            mIntegralSequence.reserve(mSequence.size());
+            for (const Polynomial& p : mSequence) {
+                UnivariatePolynomial<mpz_class> integral = p.coprimeCoefficients();
+                if (!p.isZero() && carl::sgn(integral.lcoeff()) != carl::sgn(p.lcoeff())) {
+                    integral = -integral;
+                }
+                mIntegralSequence.push_back(std::move(integral));
+            }
+        }
+    }
+
+    /**
+     * @return The polynomials of the sequence, starting with the polynomial it was computed for.
+     */
+    const std::vector<Polynomial>& polynomials() const {
+        return mSequence;
+    }
+
+    /**
+     * Counts the sign variations of the sequence at the given point.
+     * @param x Point.
+     * @return Number of sign variations.
+     */
+    std::size_t signVariations(const Coeff& x) const {
+        if constexpr (IntegralEvaluation) {
+            // b^deg(p) * p(a/b) has the same sign as p(a/b), as b is positive.
+            std::vector<mpz_class> numPowers(mDegree + 1, mpz_class(1));
+            std::vector<mpz_class> denPowers(mDegree + 1, mpz_class(1));
+            for (std::size_t i = 1; i <= mDegree; ++i) {
+                numPowers[i] = numPowers[i - 1] * x.get_num();
+                denPowers[i] = denPowers[i - 1] * x.get_den();
+            }
+            mpz_class sum;
+            mpz_class term;
+            return carl::signVariations(mIntegralSequence.begin(), mIntegralSequence.end(), [&](const UnivariatePolynomial<mpz_class>& p) {
+                const auto& coeffs = p.coefficients();
+                sum = 0;
+                for (std::size_t i = 0; i < coeffs.size(); ++i) {
+                    mpz_mul(term.get_mpz_t(), numPowers[i].get_mpz_t(), denPowers[coeffs.size() - 1 - i].get_mpz_t());
+                    mpz_addmul(sum.get_mpz_t(), coeffs[i].get_mpz_t(), term.get_mpz_t());
+                }
+                return carl::sgn(sum);
+            });
+        } else {
+            return carl::signVariations(mSequence.begin(), mSequence.end(), [&x](const Polynomial& p) { return p.sgn(x); });
+        }
+    }
+
+    /**
+     * Counts the real roots of the first polynomial within the given interval. None of the bounds may be a root.
+     * For the signed remainder sequence of p and \f$ p' q \f$, this is the Tarski query, i.e. the number of roots of p where q is positive
+     * minus the number of roots where q is negative.
+     * @param interval Interval.
+     * @return Number of real roots within the interval.
+     */
+    int countRealRoots(const Interval<Coeff>& interval) const {
+        return int(signVariations(interval.lower())) - int(signVariations(interval.upper()));
+    }
+};
+
+}  // namespace carl
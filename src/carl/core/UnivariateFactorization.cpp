@@ -0,0 +1,360 @@
+/**
+ * @file UnivariateFactorization.cpp
+ */
+
+#include "UnivariateFactorization.h"
+
+#include "../numbers/PrimeFactory.h"
+#include "UnivariatePolynomial.h"
+#include "logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <random>
+#include <utility>
+
+namespace carl {
+namespace {
+using Integer = mpz_class;
+using IntegerPolynomial = UnivariatePolynomial<Integer>;
+using ModularNumber = GFNumber<Integer>;
+using ModularPolynomial = UnivariatePolynomial<ModularNumber>;
+
+/// Number of primes that are tried to find one with few modular factors.
+constexpr std::size_t PrimeTrials = 3;
+/// The equal-degree factorization requires odd primes.
+constexpr unsigned MinimalPrime = 3;
+
+/// Returns the field of the coefficients of p.
+const GaloisField<Integer>* fieldOf(const ModularPolynomial& p) {
+    for (const ModularNumber& c : p.coefficients()) {
+        if (c.gf() != nullptr)
+            return c.gf();
+    }
+    assert(false);
+    return nullptr;
+}
+
+/// Calculates \f$ base^{exponent} \f$ modulo modulus by repeated squaring.
+ModularPolynomial powerModulo(const ModularPolynomial& base, const Integer& exponent, const ModularPolynomial& modulus, const GaloisField<Integer>* gf) {
+    ModularPolynomial res(base.mainVar(), ModularNumber(1, gf));
+    ModularPolynomial square = base.divideBy(modulus).remainder;
+    std::size_t bits = mpz_sizeinbase(exponent.get_mpz_t(), 2);
+    for (std::size_t i = 0; i < bits; ++i) {
+        if (mpz_tstbit(exponent.get_mpz_t(), i) != 0) {
+            res = (res * square).divideBy(modulus).remainder;
+        }
+        if (i + 1 < bits) {
+            square = (square * square).divideBy(modulus).remainder;
+        }
+    }
+    return res;
+}
+
+/**
+ * Splits a monic, square-free polynomial into the products of its irreducible factors of equal degree.
+ * The product of all irreducible factors of degree d is \f$ gcd(x^{q^d} - x, p) \f$ once all factors of smaller degree are removed.
+ * @return Pairs of a degree and the product of all irreducible factors of this degree.
+ */
+std::vector<std::pair<std::size_t, ModularPolynomial>> distinctDegreeFactorization(ModularPolynomial p, const GaloisField<Integer>* gf) {
+    std::vector<std::pair<std::size_t, ModularPolynomial>> res;
+    ModularPolynomial x(p.mainVar(), ModularNumber(1, gf), 1);
+    Integer q = gf->p();
+    ModularPolynomial h = x;
+    for (std::size_t d = 1; 2 * d <= p.degree(); ++d) {
+        h = powerModulo(h, q, p, gf);
+        ModularPolynomial diff = h - x;
+        if (diff.isZero()) {
+            // All remaining factors have degree d.
+            res.emplace_back(d, std::move(p));
+            return res;
+        }
+        ModularPolynomial g = ModularPolynomial::gcd(diff, p);
+        if (!g.isConstant()) {
+            p = p.divideBy(g).quotient;
+            h = h.divideBy(p).remainder;
+            res.emplace_back(d, std::move(g));
+        }
+    }
+    if (!p.isConstant()) {
+        res.emplace_back(p.degree(), std::move(p));
+    }
+    return res;
+}
+
+/**
+ * Splits a product of irreducible factors of degree d by the algorithm of Cantor and Zassenhaus.
+ * For a random polynomial a, \f$ gcd(a^{(q^d-1)/2} - 1, p) \f$ is a proper factor of p with probability about one half.
+ */
+void equalDegreeFactorization(const ModularPolynomial& p, std::size_t d, const GaloisField<Integer>* gf, std::mt19937& rng,
+                              std::vector<ModularPolynomial>& res) {
+    if (p.degree() == d) {
+        res.push_back(p);
+        return;
+    }
+    Integer exponent;
+    mpz_ui_pow_ui(exponent.get_mpz_t(), gf->p(), d);
+    exponent = (exponent - 1) / 2;
+    std::uniform_int_distribution<unsigned long> distribution(0, gf->p() - 1);
+    while (true) {
+        std::vector<ModularNumber> coeffs;
+        coeffs.reserve(p.degree());
+        for (std::size_t i = 0; i < p.degree(); ++i) {
+            coeffs.emplace_back(Integer(distribution(rng)), gf);
+        }
+        ModularPolynomial a(p.mainVar(), std::move(coeffs));
+        if (a.isConstant())
+            continue;
+        ModularPolynomial b = powerModulo(a, exponent, p, gf) - ModularPolynomial(p.mainVar(), ModularNumber(1, gf));
+        if (b.isZero())
+            continue;
+        ModularPolynomial g = ModularPolynomial::gcd(b, p);
+        if (g.isConstant() || g.degree() == p.degree())
+            continue;
+        equalDegreeFactorization(g, d, gf, rng, res);
+        equalDegreeFactorization(p.divideBy(g).quotient, d, gf, rng, res);
+        return;
+    }
+}
+
+/// Reduces n to the symmetric range modulo m.
+Integer symmetricModulo(const Integer& n, const Integer& m) {
+    Integer r;
+    mpz_fdiv_r(r.get_mpz_t(), n.get_mpz_t(), m.get_mpz_t());
+    if (2 * r > m) {
+        r -= m;
+    }
+    return r;
+}
+
+/// Reduces all coefficients of p to the symmetric range modulo m.
+IntegerPolynomial symmetricModulo(const IntegerPolynomial& p, const Integer& m) {
+    std::vector<Integer> coeffs;
+    coeffs.reserve(p.coefficients().size());
+    for (const Integer& c : p.coefficients()) {
+        coeffs.push_back(symmetricModulo(c, m));
+    }
+    return IntegerPolynomial(p.mainVar(), std::move(coeffs));
+}
+
+/// Divides p by its content and makes the leading coefficient positive.
+IntegerPolynomial primitivePart(const IntegerPolynomial& p) {
+    Integer content(0);
+    for (const Integer& c : p.coefficients()) {
+        content = carl::gcd(content, c);
+    }
+    if (p.lcoeff() < 0) {
+        content = -content;
+    }
+    std::vector<Integer> coeffs;
+    coeffs.reserve(p.coefficients().size());
+    for (const Integer& c : p.coefficients()) {
+        coeffs.push_back(carl::div(c, content));
+    }
+    return IntegerPolynomial(p.mainVar(), std::move(coeffs));
+}
+
+/**
+ * Returns a bound such that every coefficient of every factor of p, multiplied by the leading coefficient of p, is at most the bound in
+ * absolute value. Every factor g of p satisfies \f$ \|g\|_\infty \leq 2^{deg(p)} \|p\|_2 \f$.
+ */
+Integer mignotteBound(const IntegerPolynomial& p) {
+    Integer norm(0);
+    for (const Integer& c : p.coefficients()) {
+        norm += c * c;
+    }
+    norm = carl::sqrt(norm) + 1;
+    mpz_mul_2exp(norm.get_mpz_t(), norm.get_mpz_t(), p.degree());
+    return norm * carl::abs(p.lcoeff());
+}
+
+/**
+ * Lifts the factorization \f$ target = g \cdot h \f$ modulo the prime of the field to a factorization modulo \f$ prime^{exponent} \f$ by
+ * linear Hensel lifting. In every step, the error divided by the current modulus is distributed to both factors by the cofactors of
+ * \f$ s g + t h = 1 \f$.
+ * @param target Integer polynomial that is monic modulo the final modulus.
+ * @param g Monic first factor.
+ * @param h Monic second factor, coprime to g.
+ * @return Monic lifted factors.
+ */
+std::pair<IntegerPolynomial, IntegerPolynomial> henselLift(const IntegerPolynomial& target, const ModularPolynomial& g, const ModularPolynomial& h,
+                                                           const GaloisField<Integer>* gf, std::size_t exponent) {
+    Variable x = target.mainVar();
+    ModularPolynomial s(x);
+    ModularPolynomial t(x);
+    ModularPolynomial one = ModularPolynomial::extended_gcd(g, h, s, t);
+    assert(one.isConstant());
+    IntegerPolynomial liftedG = g.toIntegerDomain();
+    IntegerPolynomial liftedH = h.toIntegerDomain();
+    Integer prime = gf->p();
+    Integer modulus = prime;
+    for (std::size_t j = 1; j < exponent; ++j) {
+        IntegerPolynomial error = target - liftedG * liftedH;
+        std::vector<Integer> coeffs;
+        coeffs.reserve(error.coefficients().size());
+        for (const Integer& c : error.coefficients()) {
+            assert(mpz_divisible_p(c.get_mpz_t(), modulus.get_mpz_t()) != 0);
+            Integer quotient;
+            mpz_divexact(quotient.get_mpz_t(), c.get_mpz_t(), modulus.get_mpz_t());
+            coeffs.push_back(std::move(quotient));
+        }
+        ModularPolynomial c = IntegerPolynomial(x, std::move(coeffs)).toFiniteDomain(gf);
+        if (!c.isZero()) {
+            // Solves dg * h + dh * g = c with deg(dg) < deg(g), which keeps g monic.
+            DivisionResult<ModularPolynomial> division = (t * c).divideBy(g);
+            ModularPolynomial dh = s * c + division.quotient * h;
+            liftedG += division.remainder.toIntegerDomain() * modulus;
+            liftedH += dh.toIntegerDomain() * modulus;
+        }
+        modulus *= prime;
+    }
+    return std::make_pair(std::move(liftedG), std::move(liftedH));
+}
+
+/// Advances subset to the next subset of the same size of {0,...,n-1} in lexicographic order.
+bool nextSubset(std::vector<std::size_t>& subset, std::size_t n) {
+    std::size_t k = subset.size();
+    for (std::size_t i = k; i-- > 0;) {
+        if (subset[i] < n - k + i) {
+            ++subset[i];
+            std::iota(subset.begin() + long(i) + 1, subset.end(), subset[i] + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Finds the integer factors of p from the factors lifted modulo modulus.
+ * A subset of the lifted factors, multiplied by the leading coefficient and reduced symmetrically, is the image of a multiple of a true
+ * factor if its primitive part divides p.
+ */
+std::vector<IntegerPolynomial> recombine(IntegerPolynomial p, std::vector<IntegerPolynomial> lifted, const Integer& modulus) {
+    std::vector<IntegerPolynomial> res;
+    std::size_t size = 1;
+    while (2 * size <= lifted.size()) {
+        std::vector<std::size_t> subset(size);
+        std::iota(subset.begin(), subset.end(), 0);
+        bool found = false;
+        do {
+            // The constant coefficient of the candidate must divide the scaled constant coefficient of p.
+            Integer constant = p.lcoeff();
+            for (std::size_t i : subset) {
+                constant = symmetricModulo(constant * lifted[i].coefficients().front(), modulus);
+            }
+            if (!carl::isZero(constant) && !carl::isZero(carl::mod(p.lcoeff() * p.coefficients().front(), constant)))
+                continue;
+            IntegerPolynomial candidate(p.mainVar(), p.lcoeff());
+            for (std::size_t i : subset) {
+                candidate = symmetricModulo(candidate * lifted[i], modulus);
+            }
+            candidate = primitivePart(candidate);
+            DivisionResult<IntegerPolynomial> division = p.divideBy(candidate);
+            if (division.remainder.isZero()) {
+                CARL_LOG_TRACE("carl.core.upoly", "UnivZassenhaus: found factor " << candidate);
+                res.push_back(std::move(candidate));
+                p = std::move(division.quotient);
+                for (std::size_t i = subset.size(); i-- > 0;) {
+                    lifted.erase(lifted.begin() + long(subset[i]));
+                }
+                found = true;
+                break;
+            }
+        } while (nextSubset(subset, lifted.size()));
+        if (!found) {
+            ++size;
+        }
+    }
+    res.push_back(std::move(p));
+    return res;
+}
+}  // namespace
+
+std::vector<UnivariatePolynomial<GFNumber<mpz_class>>> finiteFieldFactorization(const UnivariatePolynomial<GFNumber<mpz_class>>& p) {
+    assert(!p.isZero());
+    assert(p.isNormal());
+    std::vector<ModularPolynomial> res;
+    if (p.isConstant())
+        return res;
+    const GaloisField<Integer>* gf = fieldOf(p);
+    assert(gf->p() % 2 == 1);
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(p.degree()));
+    for (const auto& part : distinctDegreeFactorization(p, gf)) {
+        equalDegreeFactorization(part.second, part.first, gf, rng, res);
+    }
+    return res;
+}
+
+std::vector<UnivariatePolynomial<mpz_class>> squareFreeIntegerFactorization(const UnivariatePolynomial<mpz_class>& p) {
+    assert(!p.isZero());
+    assert(p.lcoeff() > 0);
+    if (p.degree() <= 1) {
+        return {p};
+    }
+    CARL_LOG_TRACE("carl.core.upoly", "UnivZassenhaus: " << p);
+    PrimeFactory<Integer> primes;
+    const GaloisField<Integer>* gf = nullptr;
+    std::vector<std::pair<std::size_t, ModularPolynomial>> parts;
+    std::size_t factors = 0;
+    for (std::size_t trials = 0; trials < PrimeTrials;) {
+        Integer prime = primes.nextPrime();
+        if (prime < MinimalPrime || carl::isZero(carl::mod(p.lcoeff(), prime)))
+            continue;
+        const GaloisField<Integer>* field = GaloisFieldManager<Integer>::getInstance().getField(carl::toInt<GaloisField<Integer>::BaseIntType>(prime));
+        ModularPolynomial image = p.toFiniteDomain(field).normalized();
+        ModularPolynomial derivative = image.derivative();
+        if (derivative.isZero() || !ModularPolynomial::gcd(image, derivative).isConstant()) {
+            // The image is not square-free.
+            continue;
+        }
+        ++trials;
+        // The distinct-degree factorization already determines the number of modular factors.
+        auto imageParts = distinctDegreeFactorization(image, field);
+        std::size_t imageFactors = 0;
+        for (const auto& part : imageParts) {
+            imageFactors += part.second.degree() / part.first;
+        }
+        CARL_LOG_TRACE("carl.core.upoly", "UnivZassenhaus: " << imageFactors << " factors modulo " << prime);
+        if (imageFactors == 1) {
+            return {p};
+        }
+        if (gf == nullptr || imageFactors < factors) {
+            gf = field;
+            parts = std::move(imageParts);
+            factors = imageFactors;
+        }
+    }
+
+    std::vector<ModularPolynomial> modularFactors;
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(p.degree()));
+    for (const auto& part : parts) {
+        equalDegreeFactorization(part.second, part.first, gf, rng, modularFactors);
+    }
+    assert(modularFactors.size() == factors);
+
+    Integer prime = gf->p();
+    Integer bound = 2 * mignotteBound(p);
+    Integer modulus = prime;
+    std::size_t exponent = 1;
+    while (modulus <= bound) {
+        modulus *= prime;
+        ++exponent;
+    }
+    // The monic associate of p modulo the final modulus is the target of the lifting.
+    Integer inverse;
+    mpz_invert(inverse.get_mpz_t(), p.lcoeff().get_mpz_t(), modulus.get_mpz_t());
+    IntegerPolynomial target = symmetricModulo(p * inverse, modulus);
+    std::vector<IntegerPolynomial> lifted;
+    for (std::size_t i = 0; i + 1 < modularFactors.size(); ++i) {
+        ModularPolynomial rest = target.toFiniteDomain(gf).divideBy(modularFactors[i]).quotient;
+        auto pair = henselLift(target, modularFactors[i], rest, gf, exponent);
+        lifted.push_back(symmetricModulo(pair.first, modulus));
+        target = symmetricModulo(pair.second, modulus);
+    }
+    lifted.push_back(std::move(target));
+    CARL_LOG_TRACE("carl.core.upoly", "UnivZassenhaus: lifted factors modulo " << prime << "^" << exponent);
+    return recombine(p, std::move(lifted), modulus);
+}
+
+}  // namespace carl
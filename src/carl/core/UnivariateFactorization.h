@@ -0,0 +1,41 @@
+/**
+ * @file UnivariateFactorization.h
+ *
+ * Factorization of univariate polynomials over the integers by the method of Zassenhaus: the polynomial is factored modulo a small prime,
+ * the modular factors are lifted by Hensel lifting and the integer factors are recombined from the lifted factors.
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+
+#include <vector>
+
+namespace carl {
+
+template<typename Coefficient>
+class UnivariatePolynomial;
+
+/**
+ * Factors a monic, square-free polynomial over a prime field of odd characteristic into its monic irreducible factors.
+ * The polynomial is split by degree with the distinct-degree factorization and every part is split further by the probabilistic
+ * equal-degree factorization of Cantor and Zassenhaus. The random choices are seeded deterministically.
+ * @see @cite GCL92, Chapter 8
+ * @param p Monic and square-free polynomial.
+ * @return Irreducible factors whose product is p.
+ */
+std::vector<UnivariatePolynomial<GFNumber<mpz_class>>> finiteFieldFactorization(const UnivariatePolynomial<GFNumber<mpz_class>>& p);
+
+/**
+ * Factors a primitive, square-free integer polynomial with positive leading coefficient into its irreducible factors.
+ * Several primes are tried and the one with the fewest modular factors is used. The modular factors are lifted modulo a power of this
+ * prime that exceeds twice the Mignotte bound, and the integer factors are found by trial division with the products of subsets of the
+ * lifted factors, smallest subsets first.
+ * The recombination is exponential in the number of modular factors in the worst case.
+ * @see @cite GCL92, Chapter 6
+ * @param p Primitive and square-free polynomial with positive leading coefficient.
+ * @return Irreducible primitive factors with positive leading coefficients whose product is p.
+ */
+std::vector<UnivariatePolynomial<mpz_class>> squareFreeIntegerFactorization(const UnivariatePolynomial<mpz_class>& p);
+
+}  // namespace carl
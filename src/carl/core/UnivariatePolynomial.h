@@ -16,6 +16,7 @@
 
 #include "polynomialfunctions/Resultant.h"
 
+#include <array>
 #include <functional>
 #include <list>
 #include <map>
@@ -34,6 +35,9 @@ using UnivariatePolynomialPtr = std::shared_ptr<UnivariatePolynomial<Coefficient
 
 template<typename Coefficient>
 using FactorMap = std::map<UnivariatePolynomial<Coefficient>, uint>;
+
+template<typename Coefficient>
+class SturmSequence;
 }  // namespace carl
 
 #include "DivisionResult.h"
@@ -68,6 +72,8 @@ class UnivariatePolynomial : public Polynomial {
     Variable mMainVar;
     /// The coefficients.
     std::vector<Coefficient> mCoefficients;
+    /// Cached Sturm sequence, only valid if it starts with this polynomial. It is only accessed atomically from const methods.
+    mutable std::shared_ptr<const SturmSequence<Coefficient>> mSturmSequence;
 
    public:
     /**
@@ -623,6 +629,16 @@ class UnivariatePolynomial : public Polynomial {
     UnivariatePolynomial prem_old(const UnivariatePolynomial& divisor) const;
     UnivariatePolynomial prem(const UnivariatePolynomial& divisor) const;
     UnivariatePolynomial sprem(const UnivariatePolynomial& divisor) const;
+    /**
+     * Calculates the pseudo-quotient and pseudo-remainder, that is polynomials q and r with
+     * \f$ lcoeff(divisor)^{deg(this)-deg(divisor)+1} \cdot this = q \cdot divisor + r \f$ and \f$ deg(r) < deg(divisor) \f$.
+     * No coefficient is ever divided, hence this works over every integral domain and avoids the rational coefficients of divideBy() over
+     * the integers.
+     * @see @cite GCL92, page 55, Pseudo-Division Property
+     * @param divisor Divisor, must not be zero.
+     * @return Pseudo-quotient and pseudo-remainder.
+     */
+    DivisionResult<UnivariatePolynomial> pseudoDivideBy(const UnivariatePolynomial& divisor) const;
 
     /**
      * Constructs a new polynomial `q` such that \f$ q(x) = p(-x) \f$ where `p` is this polynomial.
@@ -715,6 +731,8 @@ class UnivariatePolynomial : public Polynomial {
 
     /**
      * Calculates the greatest common divisor of two polynomials.
+     * Depending on the coefficients and the degrees, the result is computed by the Euclidean algorithm, by the half-GCD algorithm for
+     * finite fields, or modulo several primes for integer and rational coefficients.
      * @param a First polynomial.
      * @param b Second polynomial.
      * @return `gcd(a,b)`
@@ -728,11 +746,19 @@ class UnivariatePolynomial : public Polynomial {
      * @param s First output polynomial.
      * @param t Second output polynomial.
      * @see @cite GCL92, Algorithm 2.2
+     * @see halfGCD() which is used for large polynomials over finite fields.
      * @return `gcd(a,b)`
      */
     static UnivariatePolynomial extended_gcd(const UnivariatePolynomial& a, const UnivariatePolynomial& b, UnivariatePolynomial& s, UnivariatePolynomial& t);
 
     Coefficient evaluate(const Coefficient& value) const;
+    /**
+     * Evaluates the polynomial at many points at once.
+     * Horner's scheme is run coefficient by coefficient over all points, which keeps the coefficient in cache and lets the loop over the points vectorize for primitive types.
+     * @param values Points to evaluate.
+     * @return Values of the polynomial at the given points.
+     */
+    std::vector<Coefficient> evaluateBatch(const std::vector<Coefficient>& values) const;
 
     template<typename C = Coefficient, EnableIf<is_number<C>> = dummy>
     void substituteIn(Variable var, const Coefficient& value);
@@ -887,6 +913,13 @@ class UnivariatePolynomial : public Polynomial {
     template<typename C = Coefficient, DisableIf<is_number<C>> = dummy>
     IntNumberType mainDenom() const;
 
+    /**
+     * Factorizes this polynomial.
+     * Rational roots are split off first, the remainder is split by the square-free factorization.
+     * For rational coefficients, the square-free factors are factored into irreducible factors by the method of Zassenhaus, see
+     * squareFreeIntegerFactorization().
+     * @return Factors with their exponents whose product is this polynomial. A constant factor is contained at most once.
+     */
     FactorMap<Coefficient> factorization() const;
 
     template<typename Integer>
@@ -921,6 +954,14 @@ class UnivariatePolynomial : public Polynomial {
     std::list<UnivariatePolynomial> standardSturmSequence() const;
     std::list<UnivariatePolynomial> standardSturmSequence(const UnivariatePolynomial& polynomial) const;
 
+    /**
+     * Returns the standard Sturm sequence of this polynomial.
+     * The sequence is computed on first use and shared with all copies of this polynomial. It is recomputed if this polynomial was
+     * changed in the meantime. The sequence is published atomically, hence this method may be called from several threads at once.
+     * @return Sturm sequence.
+     */
+    std::shared_ptr<const SturmSequence<Coefficient>> sturmSequence() const;
+
     /**
      * Counts the sign variations (i.e. an upper bound for the number of real roots) via Descarte's rule of signs.
      * This is an upper bound for countRealRoots().
@@ -930,7 +971,7 @@ class UnivariatePolynomial : public Polynomial {
     uint signVariations(const Interval<Coefficient>& interval) const;
 
     /**
-     * Count the number of real roots within the given interval using Sturm sequences.
+     * Count the number of real roots within the given interval using the cached Sturm sequence, see sturmSequence().
      * @param interval Count roots within this interval.
      * @return Number of real roots within the interval.
      */
@@ -1200,6 +1241,95 @@ class UnivariatePolynomial : public Polynomial {
      */
     UnivariatePolynomial remainder_helper(const UnivariatePolynomial& divisor, const Coefficient* prefactor = nullptr) const;
     static UnivariatePolynomial gcd_recursive(const UnivariatePolynomial& a, const UnivariatePolynomial& b);
+
+    /// Minimal number of coefficients of both factors such that multiplication with integer, rational, modular or floating point coefficients
+    /// uses Karatsuba's algorithm.
+    static constexpr std::size_t KaratsubaThreshold = 64;
+    /// Minimal number of coefficients of both factors such that multiplication of integer, rational or modular polynomials uses Kronecker
+    /// substitution.
+    static constexpr std::size_t KroneckerThreshold = 8;
+    /**
+     * Adds the product of two coefficient ranges to res by schoolbook multiplication.
+     * @param lhs First factor with lsize coefficients.
+     * @param rhs Second factor with rsize coefficients.
+     * @param res Result, must hold lsize + rsize - 1 coefficients.
+     */
+    static void multiplySchoolbook(const Coefficient* lhs, std::size_t lsize, const Coefficient* rhs, std::size_t rsize, Coefficient* res);
+    /**
+     * Adds the product of two coefficient ranges to res using Karatsuba's algorithm, which falls back to schoolbook multiplication below
+     * KaratsubaThreshold. Unbalanced factors are split into chunks of the size of the smaller factor.
+     * @param lhs First factor with lsize coefficients.
+     * @param rhs Second factor with rsize coefficients.
+     * @param res Result, must hold lsize + rsize - 1 coefficients.
+     */
+    static void multiplyKaratsuba(const Coefficient* lhs, std::size_t lsize, const Coefficient* rhs, std::size_t rsize, Coefficient* res);
+    /**
+     * Multiplies this polynomial with rhs by Kronecker substitution, see kroneckerMultiply().
+     * Only available for integer, rational and GFNumber<mpz_class> coefficients. The latter are multiplied as integers and reduced
+     * afterwards.
+     * @param rhs Second factor.
+     */
+    void multiplyByKronecker(const UnivariatePolynomial& rhs);
+
+    /// Minimal degree of both the divisor and the quotient such that division of rational polynomials uses Newton iteration.
+    static constexpr std::size_t NewtonDivisionThreshold = 32;
+    /**
+     * Checks whether the division by divisor should use quotientByNewton().
+     * @param divisor Divisor.
+     */
+    bool useNewtonDivision(const UnivariatePolynomial& divisor) const;
+    /**
+     * Calculates the quotient of the division by divisor from the power series inverse of the reversed divisor, which is computed by
+     * Newton iteration. Its cost is a few multiplications of polynomials of the size of the quotient instead of the quadratic cost of long
+     * division, and it only pays off if multiplication is fast.
+     * Only available for rational coefficients. Asserts that the degree of divisor does not exceed the degree of this polynomial.
+     * @param divisor Divisor.
+     * @return Quotient.
+     */
+    UnivariatePolynomial quotientByNewton(const UnivariatePolynomial& divisor) const;
+
+    /// Minimal degree of both polynomials such that the gcd over a finite field uses the half-GCD algorithm.
+    static constexpr std::size_t HalfGCDThreshold = 128;
+    /// Degree below which halfGCD() accumulates the steps of the Euclidean algorithm instead of recursing.
+    static constexpr std::size_t HalfGCDBaseThreshold = 32;
+    /// Minimal degree of both polynomials such that the gcd of integer or rational polynomials is computed modulo primes.
+    static constexpr std::size_t ModularGCDThreshold = 8;
+    /// Primes used by gcdModular() are at least this large, which makes unlucky primes rare.
+    static constexpr unsigned ModularGCDMinimalPrime = 1024;
+    /// A 2x2 matrix of polynomials in row-major order, mapping a pair \f$ (a,b) \f$ to \f$ (m_0 a + m_1 b, m_2 a + m_3 b) \f$.
+    using GCDMatrix = std::array<UnivariatePolynomial, 4>;
+    /**
+     * Calculates a matrix that performs the steps of the Euclidean algorithm on a and b until the degree of the second polynomial drops below
+     * half the degree of a. The quotients only depend on the leading coefficients, hence the matrix is computed recursively from the upper
+     * halves of the polynomials.
+     * Assumes that the degree of a is larger than the degree of b.
+     * @see @cite Yap00, Chapter 2
+     * @param a First polynomial.
+     * @param b Second polynomial.
+     * @return Matrix M with \f$ (c, d) = M(a,b) \f$ and \f$ deg(c) \geq \lceil deg(a)/2 \rceil > deg(d) \f$.
+     */
+    static GCDMatrix halfGCD(const UnivariatePolynomial& a, const UnivariatePolynomial& b);
+    /**
+     * Calculates the greatest common divisor over a finite field with the half-GCD algorithm.
+     * If s and t are given, they are set such that the result equals \f$ s \cdot a + t \cdot b \f$.
+     * @param a First polynomial.
+     * @param b Second polynomial.
+     * @param s First output polynomial or nullptr.
+     * @param t Second output polynomial or nullptr.
+     * @return Normalized `gcd(a,b)`.
+     */
+    static UnivariatePolynomial gcdHalfGCD(const UnivariatePolynomial& a, const UnivariatePolynomial& b, UnivariatePolynomial* s, UnivariatePolynomial* t);
+    /**
+     * Calculates the greatest common divisor of integer or rational polynomials from their gcds modulo several primes.
+     * The images are scaled to the gcd of the leading coefficients, combined by the chinese remainder theorem, and the primitive part of the
+     * result is accepted once it divides both polynomials. Primes whose image has a too large degree are skipped.
+     * @see @cite GCL92, Algorithm 7.1
+     * @param a First polynomial.
+     * @param b Second polynomial.
+     * @return Normalized `gcd(a,b)`.
+     */
+    static UnivariatePolynomial gcdModular(const UnivariatePolynomial& a, const UnivariatePolynomial& b);
+
     void stripLeadingZeroes() {
         while (!isZero() && lcoeff() == Coefficient(0)) {
             mCoefficients.pop_back();
@@ -8,26 +8,33 @@
 #pragma once
 
 #include "../converter/OldGinacConverter.h"
+#include "../numbers/PrimeFactory.h"
 #include "../util/SFINAE.h"
 #include "../util/debug.h"
 #include "../util/platform.h"
+#include "KroneckerSubstitution.h"
 #include "MultivariateGCD.h"
 #include "MultivariatePolynomial.h"
 #include "Sign.h"
+#include "SturmSequence.h"
+#include "UnivariateFactorization.h"
 #include "logging.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 
 namespace carl {
 
 template<typename Coeff>
-UnivariatePolynomial<Coeff>::UnivariatePolynomial(const UnivariatePolynomial& p) : mMainVar(p.mMainVar), mCoefficients(p.mCoefficients) {
+UnivariatePolynomial<Coeff>::UnivariatePolynomial(const UnivariatePolynomial& p)
+    : mMainVar(p.mMainVar), mCoefficients(p.mCoefficients), mSturmSequence(std::atomic_load(&p.mSturmSequence)) {
     assert(this->isConsistent());
 }
 
 template<typename Coeff>
-UnivariatePolynomial<Coeff>::UnivariatePolynomial(UnivariatePolynomial&& p) noexcept : mMainVar(p.mMainVar), mCoefficients() {
+UnivariatePolynomial<Coeff>::UnivariatePolynomial(UnivariatePolynomial&& p) noexcept
+    : mMainVar(p.mMainVar), mCoefficients(), mSturmSequence(std::move(p.mSturmSequence)) {
     mCoefficients = std::move(p.mCoefficients);
     assert(isConsistent());
 }
@@ -36,6 +43,7 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator=(const UnivariatePolynomial& p) {
     mMainVar = p.mMainVar;
     mCoefficients = p.mCoefficients;
+    mSturmSequence = std::atomic_load(&p.mSturmSequence);
     assert(isConsistent());
     return *this;
 }
@@ -44,6 +52,7 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator=(UnivariatePolynomial&& p) noexcept {
     mMainVar = p.mMainVar;
     mCoefficients = std::move(p.mCoefficients);
+    mSturmSequence = std::move(p.mSturmSequence);
     assert(isConsistent());
     return *this;
 }
@@ -120,6 +129,19 @@ Coeff UnivariatePolynomial<Coeff>::evaluate(const Coeff& value) const {
     return result;
 }
 
+template<typename Coeff>
+std::vector<Coeff> UnivariatePolynomial<Coeff>::evaluateBatch(const std::vector<Coeff>& values) const {
+    if (isZero())
+        return std::vector<Coeff>(values.size(), Coeff(0));
+    std::vector<Coeff> res(values.size(), lcoeff());
+    for (std::size_t k = mCoefficients.size() - 1; k > 0; --k) {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            res[i] = res[i] * values[i] + mCoefficients[k - 1];
+        }
+    }
+    return res;
+}
+
 template<typename Coeff>
 template<typename C, EnableIf<is_number<C>>>
 void UnivariatePolynomial<Coeff>::substituteIn(Variable var, const Coeff& value) {
@@ -211,6 +233,8 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::derivative(uint nth) co
         for (std::size_t i = 1; it != mCoefficients.end(); it++, i++) {
             result.mCoefficients.push_back(Coeff(i) * *it);
         }
+        // The leading coefficient vanishes in positive characteristic.
+        result.stripLeadingZeroes();
         CARL_LOG_DEBUG("carl.core", "1st derivative of " << *this << " = " << result);
         return result;
     } else {
@@ -227,6 +251,7 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::derivative(uint nth) co
             c /= (i - nth);
             c *= i;
         }
+        result.stripLeadingZeroes();
         CARL_LOG_DEBUG("carl.core", nth << " derivative of " << *this << " = " << result);
         return result;
     }
@@ -246,47 +271,33 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::remainder_helper(const
         return UnivariatePolynomial<Coeff>(mMainVar);
     }
 
-    Coeff factor(0);  // We have to initialize it to prevent a compiler error.
-    if (prefactor != nullptr) {
-        factor = carl::quotient(Coeff(*prefactor * lcoeff()), divisor.lcoeff());
-        // There should be no remainder.
-        assert(factor * divisor.lcoeff() == *prefactor * lcoeff());
-    } else {
-        factor = carl::quotient(lcoeff(), divisor.lcoeff());
-        // There should be no remainder.
-        assert(factor * divisor.lcoeff() == lcoeff());
+    if constexpr (std::is_same<Coeff, mpq_class>::value) {
+        if (prefactor == nullptr && useNewtonDivision(divisor)) {
+            return *this - quotientByNewton(divisor) * divisor;
+        }
     }
 
-    UnivariatePolynomial<Coeff> result(mMainVar);
-    result.mCoefficients.reserve(mCoefficients.size() - 1);
-    uint degdiff = degree() - divisor.degree();
-    if (degdiff > 0) {
-        result.mCoefficients.assign(mCoefficients.begin(), mCoefficients.begin() + long(degdiff));
-    }
+    UnivariatePolynomial<Coeff> result(*this);
     if (prefactor != nullptr) {
         for (Coeff& c : result.mCoefficients) {
             c *= *prefactor;
         }
     }
-
-    // By construction, the leading coefficient will be zero.
-    if (prefactor != nullptr) {
-        for (std::size_t i = 0; i < mCoefficients.size() - degdiff - 1; ++i) {
-            result.mCoefficients.push_back(mCoefficients[i + degdiff] * *prefactor - factor * divisor.mCoefficients[i]);
-        }
-    } else {
-        for (std::size_t i = 0; i < mCoefficients.size() - degdiff - 1; ++i) {
-            result.mCoefficients.push_back(mCoefficients[i + degdiff] - factor * divisor.mCoefficients[i]);
+    // Eliminates the leading coefficient in place until the degree drops below the degree of the divisor.
+    std::size_t m = divisor.degree();
+    while (!result.isZero() && result.degree() >= m) {
+        std::size_t degdiff = result.degree() - m;
+        Coeff factor = carl::quotient(result.lcoeff(), divisor.lcoeff());
+        // There should be no remainder.
+        assert(factor * divisor.lcoeff() == result.lcoeff());
+        for (std::size_t i = 0; i < m; ++i) {
+            result.mCoefficients[i + degdiff] -= factor * divisor.mCoefficients[i];
         }
+        // By construction, the leading coefficient is zero.
+        result.mCoefficients.pop_back();
+        result.stripLeadingZeroes();
     }
-    // strip zeros from the end as we might have pushed zeros.
-    result.stripLeadingZeroes();
-
-    if (result.isZero() || result.degree() < divisor.degree()) {
-        return result;
-    } else {
-        return result.remainder_helper(divisor, nullptr);
-    }
+    return result;
 }
 
 template<typename Coeff>
@@ -390,6 +401,91 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::sprem(const UnivariateP
     return remainder(divisor, &prefactor);
 }
 
+template<typename Coeff>
+DivisionResult<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::pseudoDivideBy(const UnivariatePolynomial<Coeff>& divisor) const {
+    assert(!divisor.isZero());
+    assert(this->mainVar() == divisor.mainVar());
+    DivisionResult<UnivariatePolynomial<Coeff>> result(UnivariatePolynomial<Coeff>(mMainVar), *this);
+    if (isZero() || degree() < divisor.degree()) {
+        // According to definition.
+        return result;
+    }
+    std::size_t m = divisor.degree();
+    std::size_t degdiff = degree() - m;
+
+    // Knuth, TAOCP Vol. 2, 4.6.1, Algorithm R: The k'th coefficient of the quotient is multiplied by lcoeff^k, all other coefficients are
+    // multiplied by lcoeff in every step.
+    std::vector<Coeff> powers(1, Coeff(1));
+    for (std::size_t k = 0; k < degdiff; ++k) {
+        powers.push_back(powers.back() * divisor.lcoeff());
+    }
+    std::vector<Coeff>& r = result.remainder.mCoefficients;
+    result.quotient.mCoefficients.resize(degdiff + 1, Coeff(0));
+    for (std::size_t k = degdiff + 1; k-- > 0;) {
+        result.quotient.mCoefficients[k] = r[m + k] * powers[k];
+        for (std::size_t j = m + k; j-- > 0;) {
+            r[j] *= divisor.lcoeff();
+            if (j >= k) {
+                r[j] -= r[m + k] * divisor.mCoefficients[j - k];
+            }
+        }
+        r.pop_back();
+    }
+    result.quotient.stripLeadingZeroes();
+    result.remainder.stripLeadingZeroes();
+    assert(result.remainder.isZero() || result.remainder.degree() < m);
+    return result;
+}
+
+template<typename Coeff>
+bool UnivariatePolynomial<Coeff>::useNewtonDivision(const UnivariatePolynomial<Coeff>& divisor) const {
+    return divisor.degree() >= NewtonDivisionThreshold && degree() >= divisor.degree() + NewtonDivisionThreshold;
+}
+
+template<typename Coeff>
+UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::quotientByNewton(const UnivariatePolynomial<Coeff>& divisor) const {
+    static_assert(std::is_same<Coeff, mpq_class>::value, "Newton division requires rational coefficients.");
+    assert(!divisor.isZero() && degree() >= divisor.degree());
+    // Reversing the coefficients turns the division into a multiplication with the power series inverse of the reversed divisor, of which
+    // only the first size coefficients are needed.
+    std::size_t size = degree() - divisor.degree() + 1;
+    auto reversed = [this](const std::vector<Coeff>& coeffs, std::size_t size) {
+        UnivariatePolynomial<Coeff> res(mMainVar);
+        res.mCoefficients.assign(coeffs.rbegin(), coeffs.rbegin() + long(std::min(size, coeffs.size())));
+        res.stripLeadingZeroes();
+        return res;
+    };
+    auto truncate = [](UnivariatePolynomial<Coeff>& p, std::size_t size) {
+        if (p.mCoefficients.size() > size) {
+            p.mCoefficients.resize(size);
+            p.stripLeadingZeroes();
+        }
+    };
+    UnivariatePolynomial<Coeff> f = reversed(divisor.mCoefficients, size);
+    // g is the inverse of f modulo x^precision, every step doubles the precision.
+    UnivariatePolynomial<Coeff> g(mMainVar, Coeff(1) / divisor.lcoeff());
+    std::size_t precision = 1;
+    while (precision < size) {
+        // g' = g * (2 - f*g)
+        std::size_t next = std::min(2 * precision, size);
+        UnivariatePolynomial<Coeff> e = f;
+        truncate(e, next);
+        e *= g;
+        truncate(e, next);
+        e = -e;
+        e += Coeff(2);
+        g *= e;
+        truncate(g, next);
+        precision = next;
+    }
+    UnivariatePolynomial<Coeff> quotient = reversed(mCoefficients, size);
+    quotient *= g;
+    quotient.mCoefficients.resize(size, Coeff(0));
+    std::reverse(quotient.mCoefficients.begin(), quotient.mCoefficients.end());
+    quotient.stripLeadingZeroes();
+    return quotient;
+}
+
 template<typename Coeff>
 bool UnivariatePolynomial<Coeff>::isNormal() const {
     return unitPart() == Coeff(1);
@@ -448,6 +544,11 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::extended_gcd(const Univ
     assert(a.mMainVar == t.mMainVar);
     assert(!a.isZero());
     assert(!b.isZero());
+    if constexpr (is_instantiation_of<GFNumber, Coeff>::value) {
+        if (std::min(a.degree(), b.degree()) >= HalfGCDThreshold) {
+            return gcdHalfGCD(a, b, &s, &t);
+        }
+    }
 
     CARL_LOG_DEBUG("carl.core", "UnivEEA: a=" << a << ", b=" << b);
     Variable x = a.mMainVar;
@@ -504,10 +605,25 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::gcd(const UnivariatePol
     assert(!a.isZero());
     assert(!b.isZero());
     assert(a.mainVar() == b.mainVar());
-    if (a.degree() < b.degree())
-        return gcd_recursive(b.normalized(), a.normalized()).normalized();
-    else
-        return gcd_recursive(a.normalized(), b.normalized()).normalized();
+    if constexpr (is_instantiation_of<GFNumber, Coeff>::value) {
+        if (std::min(a.degree(), b.degree()) >= HalfGCDThreshold) {
+            return gcdHalfGCD(a, b, nullptr, nullptr);
+        }
+    }
+    if constexpr (std::is_same<Coeff, mpz_class>::value) {
+        // The Euclidean algorithm requires a field.
+        return gcdModular(a, b);
+    } else {
+        if constexpr (std::is_same<Coeff, mpq_class>::value) {
+            if (std::min(a.degree(), b.degree()) >= ModularGCDThreshold) {
+                return gcdModular(a, b);
+            }
+        }
+        if (a.degree() < b.degree())
+            return gcd_recursive(b.normalized(), a.normalized()).normalized();
+        else
+            return gcd_recursive(a.normalized(), b.normalized()).normalized();
+    }
 }
 
 template<typename Coeff>
@@ -525,6 +641,211 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::gcd_recursive(const Uni
         return gcd_recursive(b, a.remainder(b));
 }
 
+namespace detail {
+/// Calculates the product of two 2x2 matrices in row-major order.
+template<typename Matrix>
+Matrix multiplyGCDMatrices(const Matrix& lhs, const Matrix& rhs) {
+    return Matrix{lhs[0] * rhs[0] + lhs[1] * rhs[2], lhs[0] * rhs[1] + lhs[1] * rhs[3], lhs[2] * rhs[0] + lhs[3] * rhs[2], lhs[2] * rhs[1] + lhs[3] * rhs[3]};
+}
+/// Replaces (a,b) by M(a,b).
+template<typename Matrix, typename Polynomial>
+void applyGCDMatrix(const Matrix& m, Polynomial& a, Polynomial& b) {
+    Polynomial tmp = m[0] * a + m[1] * b;
+    b = m[2] * a + m[3] * b;
+    a = std::move(tmp);
+}
+/// Replaces (a,b) by (b, a mod b) and m by the product of the matrix of this step and m.
+template<typename Matrix, typename Polynomial>
+void euclideanGCDStep(Polynomial& a, Polynomial& b, Matrix* m) {
+    DivisionResult<Polynomial> division = a.divideBy(b);
+    a = std::move(b);
+    b = std::move(division.remainder);
+    if (m != nullptr) {
+        Polynomial m2 = (*m)[0] - division.quotient * (*m)[2];
+        Polynomial m3 = (*m)[1] - division.quotient * (*m)[3];
+        (*m)[0] = std::move((*m)[2]);
+        (*m)[1] = std::move((*m)[3]);
+        (*m)[2] = std::move(m2);
+        (*m)[3] = std::move(m3);
+    }
+}
+}  // namespace detail
+
+template<typename Coeff>
+typename UnivariatePolynomial<Coeff>::GCDMatrix UnivariatePolynomial<Coeff>::halfGCD(const UnivariatePolynomial& a, const UnivariatePolynomial& b) {
+    assert(!a.isZero());
+    assert(b.isZero() || b.degree() < a.degree());
+    GCDMatrix res = {a.one(), UnivariatePolynomial<Coeff>(a.mMainVar), UnivariatePolynomial<Coeff>(a.mMainVar), a.one()};
+    std::size_t m = (a.degree() + 1) / 2;
+    if (b.isZero() || b.degree() < m) {
+        return res;
+    }
+    UnivariatePolynomial<Coeff> c(a);
+    UnivariatePolynomial<Coeff> d(b);
+    if (a.degree() < HalfGCDBaseThreshold) {
+        // Below the threshold, the matrix is accumulated from the steps of the Euclidean algorithm.
+        while (!d.isZero() && d.degree() >= m) {
+            detail::euclideanGCDStep(c, d, &res);
+        }
+        return res;
+    }
+    // Divides by x^k, dropping the lower coefficients.
+    auto upper = [](const UnivariatePolynomial<Coeff>& p, std::size_t k) {
+        UnivariatePolynomial<Coeff> res(p.mMainVar);
+        if (p.mCoefficients.size() > k) {
+            res.mCoefficients.assign(p.mCoefficients.begin() + long(k), p.mCoefficients.end());
+        }
+        return res;
+    };
+    // The first recursion reduces to three quarters of the degree, the second one to half of the degree.
+    res = halfGCD(upper(a, m), upper(b, m));
+    detail::applyGCDMatrix(res, c, d);
+    if (d.isZero() || d.degree() < m) {
+        return res;
+    }
+    detail::euclideanGCDStep(c, d, &res);
+    if (d.isZero() || d.degree() < m) {
+        return res;
+    }
+    std::size_t k = 2 * m - c.degree();
+    return detail::multiplyGCDMatrices(halfGCD(upper(c, k), upper(d, k)), res);
+}
+
+template<typename Coeff>
+UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::gcdHalfGCD(const UnivariatePolynomial& a, const UnivariatePolynomial& b, UnivariatePolynomial* s,
+                                                                    UnivariatePolynomial* t) {
+    assert(!a.isZero());
+    assert(!b.isZero());
+    assert((s == nullptr) == (t == nullptr));
+    UnivariatePolynomial<Coeff> c(a);
+    UnivariatePolynomial<Coeff> d(b);
+    GCDMatrix m = {a.one(), UnivariatePolynomial<Coeff>(a.mMainVar), UnivariatePolynomial<Coeff>(a.mMainVar), a.one()};
+    GCDMatrix* cofactors = (s == nullptr) ? nullptr : &m;
+    if (c.degree() < d.degree()) {
+        std::swap(c, d);
+        std::swap(m[0], m[1]);
+        std::swap(m[2], m[3]);
+    }
+    while (!d.isZero()) {
+        if (c.degree() > d.degree() && d.degree() >= HalfGCDBaseThreshold) {
+            GCDMatrix h = halfGCD(c, d);
+            detail::applyGCDMatrix(h, c, d);
+            if (cofactors != nullptr) {
+                m = detail::multiplyGCDMatrices(h, m);
+            }
+            if (d.isZero())
+                break;
+        }
+        // A single step guarantees progress if the half-GCD matrix is trivial.
+        detail::euclideanGCDStep(c, d, cofactors);
+    }
+    Coeff lc = c.lcoeff();
+    if (s != nullptr) {
+        *s = m[0] / lc;
+        *t = m[1] / lc;
+        assert(c / lc == *s * a + *t * b);
+    }
+    return c / lc;
+}
+
+template<typename Coeff>
+UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::gcdModular(const UnivariatePolynomial& a, const UnivariatePolynomial& b) {
+    static_assert(std::is_same<Coeff, mpz_class>::value || std::is_same<Coeff, mpq_class>::value, "Modular gcd requires integer or rational coefficients.");
+    using Integer = mpz_class;
+    assert(!a.isZero());
+    assert(!b.isZero());
+    Variable x = a.mMainVar;
+    // Makes p primitive with positive leading coefficient and returns its content.
+    auto primitive = [](UnivariatePolynomial<Integer>& p) {
+        Integer content(0);
+        for (const Integer& c : p.mCoefficients) {
+            content = carl::gcd(content, c);
+        }
+        if (p.lcoeff() < 0) {
+            content = -content;
+        }
+        for (Integer& c : p.mCoefficients) {
+            c = carl::div(c, content);
+        }
+        return carl::abs(content);
+    };
+    UnivariatePolynomial<Integer> A(x);
+    UnivariatePolynomial<Integer> B(x);
+    if constexpr (std::is_same<Coeff, mpq_class>::value) {
+        A = a.coprimeCoefficients();
+        B = b.coprimeCoefficients();
+    } else {
+        A = a;
+        B = b;
+    }
+    Integer content = carl::gcd(primitive(A), primitive(B));
+    // The leading coefficient of the gcd divides g, hence g times the monic gcd modulo p is the image of an integer multiple of the gcd.
+    Integer g = carl::gcd(A.lcoeff(), B.lcoeff());
+
+    // Returns the normalized gcd in the coefficient type from its primitive part.
+    auto result = [&](const UnivariatePolynomial<Integer>& p) {
+        UnivariatePolynomial<Coeff> res(x);
+        res.mCoefficients.reserve(p.mCoefficients.size());
+        for (const Integer& c : p.mCoefficients) {
+            res.mCoefficients.emplace_back(c);
+        }
+        if constexpr (std::is_same<Coeff, mpq_class>::value) {
+            return res.normalized();
+        } else {
+            return res * content;
+        }
+    };
+
+    PrimeFactory<Integer> primes;
+    UnivariatePolynomial<Integer> image(x);
+    Integer modulus(1);
+    // The degree of the current image, every valid image has at most the degree of the smaller polynomial.
+    std::size_t degree = std::min(A.degree(), B.degree()) + 1;
+    while (true) {
+        Integer p = primes.nextPrime();
+        if (p < ModularGCDMinimalPrime || carl::isZero(carl::mod(g, p)))
+            continue;
+        const GaloisField<Integer>* gf = GaloisFieldManager<Integer>::getInstance().getField(carl::toInt<typename GaloisField<Integer>::BaseIntType>(p));
+        UnivariatePolynomial<GFNumber<Integer>> gp = UnivariatePolynomial<GFNumber<Integer>>::gcd(A.toFiniteDomain(gf), B.toFiniteDomain(gf));
+        CARL_LOG_TRACE("carl.core", "gcd modulo " << p << " = " << gp);
+        if (gp.degree() > degree) {
+            // The prime is unlucky.
+            continue;
+        }
+        if (gp.isConstant()) {
+            return result(UnivariatePolynomial<Integer>(x, Integer(1)));
+        }
+        gp *= GFNumber<Integer>(g, gf);
+        if (gp.degree() < degree) {
+            // All previous primes were unlucky.
+            image = gp.toIntegerDomain();
+            modulus = p;
+            degree = gp.degree();
+            continue;
+        }
+        // Chinese remaindering: the coefficient c modulo the old modulus and c' modulo p becomes c + modulus * ((c' - c) / modulus mod p).
+        GFNumber<Integer> inverse = GFNumber<Integer>(modulus, gf).inverse();
+        bool changed = false;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            GFNumber<Integer> diff = (gp.mCoefficients[i] - GFNumber<Integer>(image.mCoefficients[i], gf)) * inverse;
+            if (!diff.isZero()) {
+                image.mCoefficients[i] += modulus * diff.representingInteger();
+                changed = true;
+            }
+        }
+        modulus *= p;
+        if (changed)
+            continue;
+        // The image is stable, hence its primitive part is likely the gcd.
+        UnivariatePolynomial<Integer> candidate = image;
+        primitive(candidate);
+        if (A.divideBy(candidate).remainder.isZero() && B.divideBy(candidate).remainder.isZero()) {
+            CARL_LOG_DEBUG("carl.core", "Modular gcd of " << a << " and " << b << " = " << candidate << " using modulus " << modulus);
+            return result(candidate);
+        }
+    }
+}
+
 template<typename Coefficient>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::mod(const Coefficient& modulus) {
     for (Coefficient& coeff : mCoefficients) {
@@ -728,14 +1049,24 @@ DivisionResult<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::divideB
         return result;
     assert(*this == divisor * result.quotient + result.remainder);
 
+    if (divisor.degree() > degree()) {
+        return result;
+    }
     result.quotient.mCoefficients.resize(1 + mCoefficients.size() - divisor.mCoefficients.size(), Coeff(0));
 
-    uint degdiff = this->degree() - divisor.degree();
-    for (std::size_t offset = 0; offset <= degdiff; offset++) {
-        Coeff factor = carl::quotient(result.remainder.mCoefficients[this->degree() - offset], divisor.lcoeff());
-        result.remainder -= UnivariatePolynomial<Coeff>(mMainVar, factor, degdiff - offset) * divisor;
-        result.quotient.mCoefficients[degdiff - offset] += factor;
+    std::size_t m = divisor.degree();
+    std::vector<Coeff>& r = result.remainder.mCoefficients;
+    for (std::size_t k = degree() - m + 1; k-- > 0;) {
+        Coeff factor = carl::quotient(r[m + k], divisor.lcoeff());
+        if (carl::isZero(factor))
+            continue;
+        for (std::size_t i = 0; i <= m; ++i) {
+            r[k + i] -= factor * divisor.mCoefficients[i];
+        }
+        result.quotient.mCoefficients[k] = std::move(factor);
     }
+    result.quotient.stripLeadingZeroes();
+    result.remainder.stripLeadingZeroes();
     assert(*this == divisor * result.quotient + result.remainder);
     return result;
 }
@@ -752,14 +1083,30 @@ DivisionResult<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::divideB
     if (divisor.degree() > degree()) {
         return result;
     }
+    if constexpr (std::is_same<Coeff, mpq_class>::value) {
+        if (useNewtonDivision(divisor)) {
+            result.quotient = quotientByNewton(divisor);
+            result.remainder -= result.quotient * divisor;
+            assert(*this == divisor * result.quotient + result.remainder);
+            return result;
+        }
+    }
     result.quotient.mCoefficients.resize(1 + mCoefficients.size() - divisor.mCoefficients.size(), Coeff(0));
 
-    do {
-        Coeff factor = result.remainder.lcoeff() / divisor.lcoeff();
-        uint degdiff = result.remainder.degree() - divisor.degree();
-        result.remainder -= UnivariatePolynomial<Coeff>(mMainVar, factor, degdiff) * divisor;
-        result.quotient.mCoefficients[degdiff] += factor;
-    } while (!result.remainder.isZero() && divisor.degree() <= result.remainder.degree());
+    // Eliminates the leading coefficients of the remainder in place.
+    std::size_t m = divisor.degree();
+    std::vector<Coeff>& r = result.remainder.mCoefficients;
+    for (std::size_t k = degree() - m + 1; k-- > 0;) {
+        if (r[m + k] == Coeff(0))
+            continue;
+        Coeff factor = r[m + k] / divisor.lcoeff();
+        for (std::size_t i = 0; i < m; ++i) {
+            r[k + i] -= factor * divisor.mCoefficients[i];
+        }
+        r[m + k] = Coeff(0);
+        result.quotient.mCoefficients[k] = std::move(factor);
+    }
+    result.remainder.stripLeadingZeroes();
 
     assert(*this == divisor * result.quotient + result.remainder);
     return result;
@@ -947,6 +1294,42 @@ FactorMap<Coeff> UnivariatePolynomial<Coeff>::factorization() const {
         CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: Calculating square-free factorization of " << remainingPoly);
         // Calculate the square free factorization.
         auto sff = remainingPoly.squareFreeFactorization();
+        if constexpr (std::is_same<Coeff, mpq_class>::value) {
+            // Split the square-free factors into irreducible factors over the integers. These have positive leading coefficients, hence the
+            // remaining constant factor is determined by the leading coefficient.
+            Coeff constant = remainingPoly.lcoeff();
+            for (const auto& expFactorPair : sff) {
+                if (expFactorPair.second.isConstant())
+                    continue;
+                UnivariatePolynomial<mpz_class> integral = expFactorPair.second.coprimeCoefficients();
+                if (integral.lcoeff() < 0) {
+                    integral = -integral;
+                }
+                constant /= carl::pow(Coeff(integral.lcoeff()), expFactorPair.first);
+                for (const auto& f : squareFreeIntegerFactorization(integral)) {
+                    UnivariatePolynomial<Coeff> irreducible(mainVar(), std::vector<Coeff>(f.coefficients().begin(), f.coefficients().end()));
+                    CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << irreducible << ")^" << expFactorPair.first);
+                    auto retVal = result.emplace(irreducible, expFactorPair.first);
+                    if (!retVal.second) {
+                        retVal.first->second += expFactorPair.first;
+                    }
+                }
+            }
+            if (!carl::isOne(constant)) {
+                // Merge with the rational factor.
+                for (auto it = result.begin(); it != result.end(); ++it) {
+                    if (it->first.isConstant() && it->second == 1) {
+                        constant *= it->first.lcoeff();
+                        result.erase(it);
+                        break;
+                    }
+                }
+                if (!carl::isOne(constant)) {
+                    result.emplace(UnivariatePolynomial<Coeff>(mainVar(), constant), 1);
+                }
+            }
+            return result;
+        }
         //		factor = (Coeff) 1;
         for (auto expFactorPair = sff.begin(); expFactorPair != sff.end(); ++expFactorPair) {
             //			Coeff cpf = expFactorPair->second.coprimeFactor();
@@ -1226,10 +1609,8 @@ std::map<uint, UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::squareF
         assert(!isConstant());  // Othewise, the derivative is zero and the next assertion is thrown.
         UnivariatePolynomial<Coeff> b = this->derivative();
         CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: b = " << b);
-        UnivariatePolynomial<Coeff> s(mainVar());
-        UnivariatePolynomial<Coeff> t(mainVar());
         assert(!b.isZero());
-        UnivariatePolynomial<Coeff> c = extended_gcd((*this), b, s, t);  // TODO: use gcd instead
+        UnivariatePolynomial<Coeff> c = gcd((*this), b);
         typename IntegralType<Coeff>::type numOfCpf = getNum(c.coprimeFactor());
         if (numOfCpf != 1)  // TODO: is this maybe only necessary because the extended_gcd returns a polynomial with non-integer coefficients but it shouldn't?
         {
@@ -1249,7 +1630,7 @@ std::map<uint, UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::squareF
             uint i = 1;
             while (!z.isZero()) {
                 CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: next iteration");
-                UnivariatePolynomial<Coeff> g = extended_gcd(w, z, s, t);  // TODO: use gcd instead
+                UnivariatePolynomial<Coeff> g = gcd(w, z);
                 numOfCpf = getNum(g.coprimeFactor());
                 if (numOfCpf !=
                     1)  // TODO: is this maybe only necessary because the extended_gcd returns a polynomial with non-integer coefficients but it shouldn't?
@@ -1330,6 +1711,19 @@ std::list<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::standardStur
     return seq;
 }
 
+template<typename Coeff>
+std::shared_ptr<const SturmSequence<Coeff>> UnivariatePolynomial<Coeff>::sturmSequence() const {
+    auto cached = std::atomic_load(&mSturmSequence);
+    while (!cached || cached->polynomials().front() != *this) {
+        auto seq = std::make_shared<const SturmSequence<Coeff>>(*this);
+        // If another thread published a sequence in the meantime, it is stored in cached and checked again.
+        if (std::atomic_compare_exchange_strong(&mSturmSequence, &cached, seq)) {
+            return seq;
+        }
+    }
+    return cached;
+}
+
 template<typename Coeff>
 uint UnivariatePolynomial<Coeff>::signVariations(const Interval<Coeff>& interval) const {
     if (interval.isEmpty())
@@ -1362,7 +1756,7 @@ int UnivariatePolynomial<Coeff>::countRealRoots(const Interval<Coeff>& interval)
     assert(!this->isZero());
     assert(!this->isRoot(interval.lower()));
     assert(!this->isRoot(interval.upper()));
-    return UnivariatePolynomial<Coeff>::countRealRoots(this->standardSturmSequence(), interval);
+    return sturmSequence()->countRealRoots(interval);
 }
 
 template<typename Coeff>
@@ -1559,24 +1953,137 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const typen
 template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const UnivariatePolynomial& rhs) {
     assert(mMainVar == rhs.mMainVar);
-    if (rhs.isZero()) {
+    if (isZero() || rhs.isZero()) {
         mCoefficients.clear();
         return *this;
     }
+    std::size_t minSize = std::min(mCoefficients.size(), rhs.mCoefficients.size());
+    if constexpr (std::is_same<Coeff, mpz_class>::value || std::is_same<Coeff, mpq_class>::value || std::is_same<Coeff, GFNumber<mpz_class>>::value) {
+        if (minSize >= KroneckerThreshold) {
+            multiplyByKronecker(rhs);
+            return *this;
+        }
+    }
 
-    std::vector<Coeff> newCoeffs;
-    newCoeffs.reserve(mCoefficients.size() + rhs.mCoefficients.size());
-    for (std::size_t e = 0; e < mCoefficients.size() + rhs.degree(); ++e) {
-        newCoeffs.push_back(Coeff(0));
-        for (std::size_t i = 0; i < mCoefficients.size() && i <= e; ++i) {
-            if (e - i < rhs.mCoefficients.size()) {
-                newCoeffs.back() += mCoefficients[i] * rhs.mCoefficients[e - i];
+    std::vector<Coeff> newCoeffs(mCoefficients.size() + rhs.mCoefficients.size() - 1, Coeff(0));
+    // Karatsuba's algorithm trades multiplications for additions, which does not pay off for polynomial coefficients. It also needs exact
+    // arithmetic, as the subtractions would widen interval coefficients.
+    constexpr bool exact = is_integer<Coeff>::value || is_field<Coeff>::value || std::is_floating_point<Coeff>::value;
+    if (exact && minSize >= KaratsubaThreshold) {
+        multiplyKaratsuba(mCoefficients.data(), mCoefficients.size(), rhs.mCoefficients.data(), rhs.mCoefficients.size(), newCoeffs.data());
+    } else {
+        multiplySchoolbook(mCoefficients.data(), mCoefficients.size(), rhs.mCoefficients.data(), rhs.mCoefficients.size(), newCoeffs.data());
+    }
+    mCoefficients.swap(newCoeffs);
+    stripLeadingZeroes();
+    return *this;
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::multiplySchoolbook(const Coeff* lhs, std::size_t lsize, const Coeff* rhs, std::size_t rsize, Coeff* res) {
+    // Every coefficient of the result is accumulated at once, which is faster than scattering the products for polynomial coefficients.
+    for (std::size_t e = 0; e < lsize + rsize - 1; ++e) {
+        for (std::size_t i = (e < rsize) ? 0 : e - rsize + 1; i < lsize && i <= e; ++i) {
+            res[e] += lhs[i] * rhs[e - i];
+        }
+    }
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::multiplyKaratsuba(const Coeff* lhs, std::size_t lsize, const Coeff* rhs, std::size_t rsize, Coeff* res) {
+    if (lsize < rsize) {
+        std::swap(lhs, rhs);
+        std::swap(lsize, rsize);
+    }
+    if (rsize < KaratsubaThreshold) {
+        multiplySchoolbook(lhs, lsize, rhs, rsize, res);
+        return;
+    }
+    if (2 * rsize <= lsize) {
+        for (std::size_t i = 0; i < lsize; i += rsize) {
+            multiplyKaratsuba(lhs + i, std::min(rsize, lsize - i), rhs, rsize, res + i);
+        }
+        return;
+    }
+    // lhs = l1 * x^m + l0 and rhs = r1 * x^m + r0, where l0 and r0 have m coefficients.
+    // The product is l1*r1 * x^2m + ((l0+l1)*(r0+r1) - l0*r0 - l1*r1) * x^m + l0*r0.
+    std::size_t m = lsize / 2;
+    std::size_t l1size = lsize - m;
+    std::size_t r1size = rsize - m;
+    std::vector<Coeff> low(2 * m - 1, Coeff(0));
+    std::vector<Coeff> high(l1size + r1size - 1, Coeff(0));
+    multiplyKaratsuba(lhs, m, rhs, m, low.data());
+    multiplyKaratsuba(lhs + m, l1size, rhs + m, r1size, high.data());
+
+    std::vector<Coeff> lsum(lhs + m, lhs + lsize);
+    for (std::size_t i = 0; i < m; ++i) {
+        lsum[i] += lhs[i];
+    }
+    std::vector<Coeff> rsum(rhs, rhs + m);
+    if (r1size > m) {
+        rsum.resize(r1size, Coeff(0));
+    }
+    for (std::size_t i = 0; i < r1size; ++i) {
+        rsum[i] += rhs[m + i];
+    }
+    std::vector<Coeff> middle(lsum.size() + rsum.size() - 1, Coeff(0));
+    multiplyKaratsuba(lsum.data(), lsum.size(), rsum.data(), rsum.size(), middle.data());
+    for (std::size_t i = 0; i < low.size(); ++i) {
+        middle[i] -= low[i];
+        res[i] += low[i];
+    }
+    for (std::size_t i = 0; i < high.size(); ++i) {
+        middle[i] -= high[i];
+        res[2 * m + i] += high[i];
+    }
+    // The highest coefficients of middle vanish if rsum is longer than needed.
+    for (std::size_t i = 0; i < middle.size() && m + i < lsize + rsize - 1; ++i) {
+        res[m + i] += middle[i];
+    }
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::multiplyByKronecker(const UnivariatePolynomial& rhs) {
+    // Scales the coefficients to integers. The polynomial is divided by the resulting denominator.
+    auto substitute = [](const std::vector<Coeff>& coeffs, mpz_class& denominator) {
+        denominator = 1;
+        if constexpr (std::is_same<Coeff, mpq_class>::value) {
+            for (const auto& c : coeffs) {
+                denominator = carl::lcm(denominator, getDenom(c));
             }
         }
+        SparseIntegerPolynomial res;
+        res.reserve(coeffs.size());
+        for (std::size_t i = 0; i < coeffs.size(); ++i) {
+            if (carl::isZero(coeffs[i]))
+                continue;
+            if constexpr (std::is_same<Coeff, mpq_class>::value) {
+                res.emplace_back(i, getNum(coeffs[i]) * (denominator / getDenom(coeffs[i])));
+            } else if constexpr (std::is_same<Coeff, GFNumber<mpz_class>>::value) {
+                res.emplace_back(i, coeffs[i].representingInteger());
+            } else {
+                res.emplace_back(i, coeffs[i]);
+            }
+        }
+        return res;
+    };
+    mpz_class lhsDenominator;
+    mpz_class rhsDenominator;
+    SparseIntegerPolynomial product = kroneckerMultiply(substitute(mCoefficients, lhsDenominator), substitute(rhs.mCoefficients, rhsDenominator));
+    mpz_class denominator = lhsDenominator * rhsDenominator;
+    std::vector<Coeff> newCoeffs(mCoefficients.size() + rhs.mCoefficients.size() - 1, Coeff(0));
+    for (auto& c : product) {
+        if constexpr (std::is_same<Coeff, mpq_class>::value) {
+            newCoeffs[c.first] = Coeff(c.second, denominator);
+            newCoeffs[c.first].canonicalize();
+        } else if constexpr (std::is_same<Coeff, GFNumber<mpz_class>>::value) {
+            newCoeffs[c.first] = Coeff(c.second, lcoeff().gf() != nullptr ? lcoeff().gf() : rhs.lcoeff().gf());
+        } else {
+            newCoeffs[c.first] = std::move(c.second);
+        }
     }
     mCoefficients.swap(newCoeffs);
     stripLeadingZeroes();
-    return *this;
 }
 
 template<typename C>
@@ -13,13 +13,12 @@ MultivariatePolynomial<C, O, P> SPolynomial(const MultivariatePolynomial<C, O, P
 
     if (p.nrTerms() == 1 && q.nrTerms() == 1) {
         return MultivariatePolynomial<C, O, P>();
-    } else if (p.nrTerms() == 1) {
-        return -(p.lterm().calcLcmAndDivideBy(q.lmon()) * q.tail());
-    } else if (q.nrTerms() == 1) {
-        return (q.lterm().calcLcmAndDivideBy(p.lmon()) * p.tail());
-    } else {
-        return (p.tail() * q.lterm().calcLcmAndDivideBy(p.lmon())) - (q.tail() * p.lterm().calcLcmAndDivideBy(q.lmon()));
     }
+    // The leading terms of both multiples cancel, the multiple of q is subtracted in a single pass.
+    MultivariatePolynomial<C, O, P> res(p);
+    res *= q.lterm().calcLcmAndDivideBy(p.lmon());
+    res.subtractProduct(p.lterm().calcLcmAndDivideBy(q.lmon()), q);
+    return res;
 }
 
 }  // namespace carl
@@ -220,11 +220,6 @@ class IncrementalRootFinder : public AbstractRootFinder<Number>, public RootFind
     using QueueItem = std::tuple<Interval<Number>, SplittingStrategy>;
 
    private:
-    /**
-     * Caches the sturm sequence of the polynomial
-     */
-    std::list<UnivariatePolynomial<Number>> sturmSequence;
-
     /**
      * The current default strategy.
      */
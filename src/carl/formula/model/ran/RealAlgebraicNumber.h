@@ -86,7 +86,7 @@ class RealAlgebraicNumber {
     explicit RealAlgebraicNumber(Variable var, bool isRoot = true)
         : mIsRoot(isRoot), mIR(std::make_shared<IntervalContent>(Polynomial(var), Interval<Number>::zeroInterval())) {}
     explicit RealAlgebraicNumber(const Polynomial& p, const Interval<Number>& i, bool isRoot = true)
-        : mIsRoot(isRoot), mIR(std::make_shared<IntervalContent>(p.normalized(), i)) {
+        : mIsRoot(isRoot), mIR(std::make_shared<IntervalContent>(p.normalized(), i, p.sturmSequence())) {
         assert(!mIR->polynomial.isZero() && mIR->polynomial.degree() > 0);
         assert(i.isOpenInterval() || i.isPointInterval());
         assert(p.countRealRoots(i) == 1);
@@ -244,7 +244,7 @@ class RealAlgebraicNumber {
     const auto& getIRSturmSequence() const {
         assert(!isNumeric());
         assert(isInterval());
-        return mIR->sturmSequence;
+        return *mIR->sturmSequence;
     }
 
     RealAlgebraicNumber changeVariable(Variable v) const {
@@ -57,12 +57,10 @@ bool RealAlgebraicNumber<Number>::equal(const RealAlgebraicNumber<Number>& n) co
         auto g = UnivariatePolynomial<Number>::gcd(getIRPolynomial(), n.getIRPolynomial());
         if (!isRootOf(g))
             return false;
-        mIR->polynomial = g;
-        mIR->sturmSequence = g.standardSturmSequence();
+        mIR->setPolynomial(g);
         if (!n.isRootOf(g))
             return false;
-        n.mIR->polynomial = g;
-        n.mIR->sturmSequence = mIR->sturmSequence;
+        n.mIR->setPolynomial(g, mIR->sturmSequence);
         return equal(n);
     }
     return equal(n);
@@ -165,11 +165,11 @@ RealAlgebraicNumber<Number> evaluateIR(const MultivariatePolynomial<Number>& p,
     Interval<Number> interval = IntervalEvaluation::evaluate(poly, varToInterval);
     CARL_LOG_DEBUG("carl.ran", "-> " << interval);
 
-    auto sturmSeq = res.standardSturmSequence();
+    auto sturmSeq = res.sturmSequence();
     // the interval should include at least one root.
     assert(!res.isZero());
-    assert(res.sgn(interval.lower()) == Sign::ZERO || res.sgn(interval.upper()) == Sign::ZERO || res.countRealRoots(sturmSeq, interval) >= 1);
-    while (res.sgn(interval.lower()) == Sign::ZERO || res.sgn(interval.upper()) == Sign::ZERO || res.countRealRoots(sturmSeq, interval) != 1) {
+    assert(res.sgn(interval.lower()) == Sign::ZERO || res.sgn(interval.upper()) == Sign::ZERO || sturmSeq->countRealRoots(interval) >= 1);
+    while (res.sgn(interval.lower()) == Sign::ZERO || res.sgn(interval.upper()) == Sign::ZERO || sturmSeq->countRealRoots(interval) != 1) {
         // refine the result interval until it isolates exactly one real root of the result polynomial
         for (auto it = m.begin(); it != m.end(); it++) {
             it->second.refine();
@@ -183,8 +183,9 @@ RealAlgebraicNumber<Number> evaluateIR(const MultivariatePolynomial<Number>& p,
         }
         interval = IntervalEvaluation::evaluate(poly, varToInterval);
     }
-    CARL_LOG_DEBUG("carl.ran", "Result is " << RealAlgebraicNumber<Number>(res, interval, sturmSeq));
-    return RealAlgebraicNumber<Number>(res, interval, sturmSeq);
+    // The Sturm sequence is cached in res and reused by the result.
+    CARL_LOG_DEBUG("carl.ran", "Result is " << RealAlgebraicNumber<Number>(res, interval));
+    return RealAlgebraicNumber<Number>(res, interval);
 }
 
 template<typename Number, typename Coeff>
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "../../../core/SturmSequence.h"
 #include "../../../core/UnivariatePolynomial.h"
 
 #include "../../../interval/Interval.h"
 
 #include <list>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace carl {
 namespace ran {
@@ -16,36 +20,86 @@ struct IntervalContent {
     using Polynomial = UnivariatePolynomial<Number>;
 
     static const Variable auxVariable;
+    /// Number of points whose sign variations are kept, bisection evaluates every bound twice.
+    static constexpr std::size_t SignVariationCacheSize = 2;
 
     Polynomial polynomial;
     Interval<Number> interval;
-    std::list<Polynomial> sturmSequence;
+    /// Sturm sequence of the polynomial, shared by all numbers that are roots of the same polynomial.
+    std::shared_ptr<const SturmSequence<Number>> sturmSequence;
     std::size_t refinementCount;
 
+   private:
+    /// Sign variations of the Sturm sequence at the most recently evaluated points, only valid for the current sturmSequence.
+    std::vector<std::pair<Number, std::size_t>> signVariationCache;
+
+   public:
     Polynomial replaceVariable(const Polynomial& p) const {
         return p.replaceVariable(auxVariable);
     }
 
     IntervalContent(const Polynomial& p, const Interval<Number> i)
-        : polynomial(replaceVariable(p)), interval(i), sturmSequence(p.standardSturmSequence()), refinementCount(0) {}
+        : polynomial(replaceVariable(p)), interval(i), sturmSequence(p.sturmSequence()), refinementCount(0) {}
 
     IntervalContent(const Polynomial& p, const Interval<Number> i, const std::list<UnivariatePolynomial<Number>>& seq)
-        : polynomial(replaceVariable(p)), interval(i), sturmSequence(seq), refinementCount(0) {}
+        : polynomial(replaceVariable(p)), interval(i), sturmSequence(std::make_shared<const SturmSequence<Number>>(seq)), refinementCount(0) {}
+
+    /**
+     * The Sturm sequence may belong to any nonzero multiple of p, as this does not change the sign variations.
+     */
+    IntervalContent(const Polynomial& p, const Interval<Number> i, std::shared_ptr<const SturmSequence<Number>> seq)
+        : polynomial(replaceVariable(p)), interval(i), sturmSequence(std::move(seq)), refinementCount(0) {}
     bool isIntegral() {
         return interval.isPointInterval() && carl::isInteger(interval.lower());
     }
 
     void setPolynomial(const Polynomial& p) {
         polynomial = replaceVariable(p);
-        sturmSequence = polynomial.standardSturmSequence();
+        sturmSequence = polynomial.sturmSequence();
+        signVariationCache.clear();
+    }
+
+    /**
+     * The Sturm sequence may belong to any nonzero multiple of p, as this does not change the sign variations.
+     */
+    void setPolynomial(const Polynomial& p, std::shared_ptr<const SturmSequence<Number>> seq) {
+        polynomial = replaceVariable(p);
+        sturmSequence = std::move(seq);
+        signVariationCache.clear();
+    }
+
+    /**
+     * Counts the sign variations of the Sturm sequence at the given point, using the sign variations at recently evaluated points.
+     * @param x Point.
+     * @return Number of sign variations.
+     */
+    std::size_t signVariations(const Number& x) {
+        for (const auto& entry : signVariationCache) {
+            if (entry.first == x)
+                return entry.second;
+        }
+        std::size_t res = sturmSequence->signVariations(x);
+        if (signVariationCache.size() == SignVariationCacheSize) {
+            signVariationCache.erase(signVariationCache.begin());
+        }
+        signVariationCache.emplace_back(x, res);
+        return res;
+    }
+
+    /**
+     * Counts the real roots of the polynomial within the given interval using the Sturm sequence. None of the bounds may be a root.
+     * @param i Interval.
+     * @return Number of real roots within the interval.
+     */
+    int countRealRoots(const Interval<Number>& i) {
+        return int(signVariations(i.lower())) - int(signVariations(i.upper()));
     }
 
     Sign sgn(const Polynomial& p) const {
         Polynomial tmp = replaceVariable(p);
         if (polynomial == tmp)
             return Sign::ZERO;
-        auto seq = polynomial.standardSturmSequence(polynomial.derivative() * tmp);
-        int variations = Polynomial::countRealRoots(seq, interval);
+        int variations = SturmSequence<Number>(polynomial, polynomial.derivative() * tmp).countRealRoots(interval);
         assert((variations == -1) || (variations == 0) || (variations == 1));
         switch (variations) {
             case -1:
@@ -66,7 +120,7 @@ struct IntervalContent {
         if (polynomial.isRoot(pivot)) {
             interval = Interval<Number>(pivot, pivot);
         } else {
-            if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+            if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
                 interval.setUpper(pivot);
             } else {
                 interval.setLower(pivot);
@@ -89,7 +143,7 @@ struct IntervalContent {
                 interval = Interval<Number>(n, n);
                 return true;
             }
-            if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+            if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
                 interval.setUpper(n);
             } else {
                 interval.setLower(n);
@@ -114,7 +168,7 @@ struct IntervalContent {
             interval.setUpper(newBound);
         }
 
-        while (polynomial.countRealRoots(interval) == 0) {
+        while (countRealRoots(interval) == 0) {
             if (isLeft) {
                 Number oldBound = interval.lower();
                 newBound = Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT).sample();
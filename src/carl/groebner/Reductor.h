@@ -12,6 +12,9 @@
 #include "Ideal.h"
 #include "ReductorEntry.h"
 
+#include <memory>
+#include <unordered_map>
+
 namespace carl {
 
 /**
@@ -71,6 +74,8 @@ class Reductor {
     std::vector<Term<Coeff>> mRemainder;
     bool mReductionOccured;
     BitVector mReasons;
+    /// Fully ordered tails of the divisors used so far, shared by all entries reducing with the same divisor.
+    std::unordered_map<const PolynomialInIdeal*, std::shared_ptr<const InputPolynomial>> mTails;
 
    public:
     Reductor(const Ideal<PolynomialInIdeal>& ideal, const InputPolynomial& f)
@@ -134,7 +139,7 @@ class Reductor {
                     mReasons.calculateUnion(divres.mDivisor->getReasons());
                 }
                 if (divres.mDivisor->nrTerms() > 1) {
-                    insert(divres.mDivisor->tail(true), divres.mFactor);
+                    insert(tail(divres.mDivisor), divres.mFactor);
                 }
             } else {
                 CARL_LOG_DEBUG("carl.gb.reductor", "Not reducible: " << leadingTerm);
@@ -183,7 +188,7 @@ class Reductor {
      */
     inline bool updateDatastruct(EntryType* entry) {
         assert(!mDatastruct.empty());
-        if (entry->getTail().isZero()) {
+        if (!entry->hasTail()) {
             mDatastruct.pop();
             delete entry;
             if (mDatastruct.empty())
@@ -203,6 +208,24 @@ class Reductor {
         }
     }
 
+    void insert(const std::shared_ptr<const InputPolynomial>& g, const Term<Coeff>& fact) {
+        CARL_LOG_TRACE("carl.gb.reductor", "Insert polynomial: " << *g << " * " << fact);
+        mDatastruct.push(new EntryType(fact, g));
+    }
+
+    /**
+     * Returns the tail of the divisor, which is only computed once for every divisor.
+     * @param divisor
+     * @return
+     */
+    const std::shared_ptr<const InputPolynomial>& tail(const PolynomialInIdeal* divisor) {
+        auto it = mTails.find(divisor);
+        if (it == mTails.end()) {
+            it = mTails.emplace(divisor, std::make_shared<const InputPolynomial>(divisor->tail(true))).first;
+        }
+        return it->second;
+    }
+
     void insert(const Term<Coeff>& g) {
         assert(g.getCoeff() != 0);
         mDatastruct.push(new EntryType(g));
@@ -16,17 +16,25 @@ namespace carl {
 /**
  * An entry in the reduction polynomial.
  * The class decodes a polynomial given by
- * mLead + mMultiple * mTail.
+ * mLead + mMultiple * mTail, where mTail are the mRemaining smallest terms of a fully ordered polynomial.
+ * The polynomial is shared with all other entries which are multiples of the same polynomial and is never modified.
  * @ingroup gb
  */
 template<class Polynomial>
 class ReductorEntry {
    protected:
     using Coeff = typename Polynomial::CoeffType;
-    Polynomial mTail;
+    std::shared_ptr<const Polynomial> mTail;
+    std::size_t mRemaining;
     Term<Coeff> mLead;
     Term<Coeff> mMultiple;
 
+    static std::shared_ptr<const Polynomial> ordered(const Polynomial& pol) {
+        auto res = std::make_shared<Polynomial>(pol);
+        res->makeOrdered();
+        return res;
+    }
+
    public:
     /**
      * Constructor with a factor and a polynomial
@@ -34,21 +42,31 @@ class ReductorEntry {
      * @param pol
      * Resulting polynomial = multiple * pol.
      */
-    ReductorEntry(const Term<Coeff>& multiple, const Polynomial& pol) : mTail(pol.tail()), mLead(multiple * pol.lterm()), mMultiple(multiple) {
+    ReductorEntry(const Term<Coeff>& multiple, const Polynomial& pol) : ReductorEntry(multiple, ordered(pol)) {}
+
+    /**
+     * Constructor with a factor and a shared polynomial
+     * @param multiple
+     * @param pol Fully ordered polynomial.
+     * Resulting polynomial = multiple * pol.
+     */
+    ReductorEntry(const Term<Coeff>& multiple, std::shared_ptr<const Polynomial> pol)
+        : mTail(std::move(pol)), mRemaining(mTail->nrTerms() - 1), mLead(multiple * mTail->lterm()), mMultiple(multiple) {
         assert(!multiple.isZero());
+        assert(mTail->isOrdered());
     }
 
     /**
      * Constructor with implicit factor = 1
      * @param pol
      */
-    explicit ReductorEntry(const Term<Coeff>& pol) : mTail(), mLead(pol), mMultiple(Term<Coeff>(Coeff(1))) {}
+    explicit ReductorEntry(const Term<Coeff>& pol) : mTail(), mRemaining(0), mLead(pol), mMultiple(Term<Coeff>(Coeff(1))) {}
 
     /**
-     * @return The tail of the polynomial, not multiplied by the correct factor!
+     * @return true iff there are terms besides the leading term.
      */
-    const Polynomial& getTail() const {
-        return mTail;
+    bool hasTail() const {
+        return mRemaining != 0;
     }
 
     /**
@@ -71,10 +89,10 @@ class ReductorEntry {
      * Calculate p - lt(p).
      */
     void removeLeadingTerm() {
-        assert(mTail.nrTerms() != 0);
+        assert(mRemaining != 0);
         assert(!mMultiple.isZero());
-        mLead = mMultiple * mTail.lterm();
-        mTail.stripLT();
+        --mRemaining;
+        mLead = mMultiple * *(mTail->begin() + long(mRemaining));
     }
 
     /**
@@ -84,12 +102,12 @@ class ReductorEntry {
      */
     bool addCoefficient(const Coeff& coeffToBeAdded) {
         assert(!empty());
-        Coeff newCoeff = mLead->coeff() + coeffToBeAdded;
+        Coeff newCoeff = mLead.coeff() + coeffToBeAdded;
 
         if (newCoeff != 0) {
-            mLead = Term<Coeff>(newCoeff, mLead->monomial());
+            mLead = Term<Coeff>(newCoeff, mLead.monomial());
             return false;
-        } else if (mTail.nrTerms() != 0) {
+        } else if (hasTail()) {
             removeLeadingTerm();
         } else {
             mLead = Term<Coeff>();
@@ -102,7 +120,7 @@ class ReductorEntry {
      * @return true iff the polynomial equals zero
      */
     bool empty() const {
-        assert(!mLead.isZero() || mTail.isZero());
+        assert(!mLead.isZero() || !hasTail());
         return mLead.isZero();
     }
 
@@ -111,11 +129,14 @@ class ReductorEntry {
      * @param os
      */
     void print(std::ostream& os = std::cout) {
-        assert(mMultiple);
         if (empty()) {
             os << " ";
         } else {
-            os << mLead << " +(" << mMultiple << " * " << mTail << ")";
+            os << mLead << " +(" << mMultiple << " * (";
+            for (std::size_t i = mRemaining; i > 0; --i) {
+                os << *(mTail->begin() + long(i - 1)) << (i > 1 ? " + " : "");
+            }
+            os << "))";
         }
     }
 
@@ -20,6 +20,13 @@ class GFNumber {
     IntegerType mN = carl::constant_zero<IntegerType>::get();
     const GaloisField<IntegerType>* mGf = nullptr;
 
+    /// Maps the representing integer back to the symmetric range of the field, if the field is known.
+    void reduce() {
+        if (mGf != nullptr) {
+            mN = mGf->symmetricModulo(mN);
+        }
+    }
+
    public:
     GFNumber() = default;
     explicit GFNumber(IntegerType n, const GaloisField<IntegerType>* gf = nullptr) : mN(gf == nullptr ? n : gf->symmetricModulo(n)), mGf(gf) {}
@@ -38,7 +45,7 @@ class GFNumber {
         if (isZero() || isUnit())
             return;
         assert(mGf != nullptr);
-        mGf->modulo(mN);
+        mN = mGf->modulo(mN);
     }
 
     bool isZero() const {
@@ -169,13 +176,12 @@ GFNumber<IntegerT> abs(const GFNumber<IntegerT>& n) {
 }
 
 /**
- * @todo Implement this
- * @param
- * @return
+ * Every element of a galois field is represented by an integer, see GFNumber::representingInteger().
+ * @return true
  */
 template<typename IntegerT>
 inline bool isInteger(const GFNumber<IntegerT>& /*unused*/) {
-    return false;
+    return true;
 }
 
 /**
@@ -103,6 +103,7 @@ GFNumber<IntegerT> operator+(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator++() {
     mN++;
+    reduce();
     return *this;
 }
 
@@ -112,12 +113,14 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator+=(const GFNumber& rhs) {
         mGf = rhs.mGf;
     }
     mN += rhs.mN;
+    reduce();
     return *this;
 }
 
 template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator+=(const IntegerType& rhs) {
     mN += rhs;
+    reduce();
     return *this;
 }
 
@@ -138,6 +141,7 @@ GFNumber<IntegerT> operator-(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator--() {
     mN--;
+    reduce();
     return *this;
 }
 
@@ -149,12 +153,14 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator-=(const GFNumber& rhs) {
         mGf = rhs.mGf;
     }
     mN -= rhs.mN;
+    reduce();
     return *this;
 }
 
 template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator-=(const IntegerType& rhs) {
     mN -= rhs;
+    reduce();
     return *this;
 }
 
@@ -174,14 +180,19 @@ GFNumber<IntegerT> operator*(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator*=(const GFNumber& rhs) {
-    assert(rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+    assert(mGf == nullptr || rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+    if (mGf == nullptr) {
+        mGf = rhs.mGf;
+    }
     mN *= rhs.mN;
+    reduce();
     return *this;
 }
 
 template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator*=(const IntegerType& rhs) {
     mN *= rhs;
+    reduce();
     return *this;
 }
 
@@ -195,7 +206,10 @@ GFNumber<IntegerT> operator/(const GFNumber<IntegerT>& lhs, const GFNumber<Integ
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator/=(const GFNumber<IntegerT>& rhs) {
     assert(!rhs.isZero());
-    mN* rhs.inverse().mN;
+    assert(rhs.mGf != nullptr);
+    mGf = rhs.mGf;
+    mN *= rhs.inverse().mN;
+    reduce();
     return *this;
 }
 
@@ -75,6 +75,9 @@ class GaloisField {
     IntegerType symmetricModulo(const IntegerType& n) const {
         if (n > mMaxValue) {
             return carl::mod(IntegerType(n - mModulus), mPK) - mMaxValue;
+        } else if (n < -mMaxValue) {
+            // carl::mod() keeps the sign of n, hence negative values are mirrored.
+            return mMaxValue - carl::mod(IntegerType(mMaxValue - n), mPK);
         } else {
             return carl::mod(n, mPK);
         }
@@ -143,6 +143,12 @@ inline uint toInt<uint>(const cln::cl_I& n) {
     assert(n >= std::numeric_limits<uint>::min());
     return uint(cln::cl_I_to_long(n));
 }
+template<>
+inline unsigned toInt<unsigned>(const cln::cl_I& n) {
+    assert(n <= std::numeric_limits<unsigned>::max());
+    assert(n >= std::numeric_limits<unsigned>::min());
+    return unsigned(cln::cl_I_to_long(n));
+}
 
 template<typename To, typename From>
 inline To fromInt(const From& n);
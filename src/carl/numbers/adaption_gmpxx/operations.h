@@ -132,6 +132,12 @@ inline uint toInt<uint>(const mpz_class& n) {
     assert(n >= std::numeric_limits<unsigned long>::min());
     return mpz_get_ui(n.get_mpz_t());
 }
+template<>
+inline unsigned toInt<unsigned>(const mpz_class& n) {
+    assert(n <= std::numeric_limits<unsigned>::max());
+    assert(n >= std::numeric_limits<unsigned>::min());
+    return unsigned(mpz_get_ui(n.get_mpz_t()));
+}
 
 template<typename Integer>
 inline Integer toInt(const mpq_class& n);
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "../config.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Storage for objects of a single type.
+ * Memory is requested in chunks of many objects and released slots are kept in a free list, hence objects allocated one after another are likely
+ * to be close to each other and most allocations do not involve the system allocator.
+ * The memory is only returned to the system when the slab is destructed. An owner that may be outlived by the objects gives up the slab with
+ * release() instead, which destructs it once the last object is deallocated.
+ */
+template<typename T, std::size_t ChunkSize = 1024>
+class Slab {
+   private:
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte data[sizeof(T)];
+    };
+    std::vector<std::unique_ptr<Slot[]>> mChunks;
+    Slot* mFree = nullptr;
+    std::size_t mAllocated = 0;
+    /// If the owner gave up the slab, see release().
+    bool mReleased = false;
+#ifdef CARL_THREAD_SAFE
+    mutable std::mutex mMutex;
+#define SLAB_LOCK std::lock_guard<std::mutex> lock(mMutex)
+#else
+#define SLAB_LOCK
+#endif
+   public:
+    /**
+     * Allocates uninitialized memory for a single object.
+     */
+    void* allocate() {
+        SLAB_LOCK;
+        if (mFree == nullptr) {
+            mChunks.emplace_back(new Slot[ChunkSize]);
+            Slot* chunk = mChunks.back().get();
+            for (std::size_t i = 0; i < ChunkSize; ++i) {
+                chunk[i].next = (i + 1 < ChunkSize) ? &chunk[i + 1] : nullptr;
+            }
+            mFree = chunk;
+        }
+        Slot* res = mFree;
+        mFree = res->next;
+        ++mAllocated;
+        return res->data;
+    }
+    /**
+     * Releases memory obtained from allocate(). The object must already be destructed.
+     */
+    void deallocate(void* p) {
+        bool unused;
+        {
+            SLAB_LOCK;
+            Slot* slot = std::launder(reinterpret_cast<Slot*>(p));
+            slot->next = mFree;
+            mFree = slot;
+            --mAllocated;
+            unused = mReleased && mAllocated == 0;
+        }
+        if (unused) {
+            delete this;
+        }
+    }
+    /**
+     * Gives up this slab, which must have been created by new. It is destructed immediately if no object is allocated, otherwise when the last
+     * object is deallocated.
+     */
+    void release() {
+        bool unused;
+        {
+            SLAB_LOCK;
+            mReleased = true;
+            unused = mAllocated == 0;
+        }
+        if (unused) {
+            delete this;
+        }
+    }
+    /**
+     * @return Number of objects currently allocated.
+     */
+    std::size_t size() const {
+        SLAB_LOCK;
+        return mAllocated;
+    }
+    /**
+     * @return Number of objects that fit into the memory requested so far.
+     */
+    std::size_t capacity() const {
+        SLAB_LOCK;
+        return mChunks.size() * ChunkSize;
+    }
+
+#undef SLAB_LOCK
+};
+
+/**
+ * Allocator that places single objects in the slots of a Slab<Storage>.
+ * It is meant for std::allocate_shared, which allocates the object together with its control block in a single slot. Storage must be large
+ * enough for the control block, which is checked when the allocator is used for it.
+ */
+template<typename T, typename Storage>
+class SlabAllocator {
+    template<typename U, typename S>
+    friend class SlabAllocator;
+
+    Slab<Storage>* mSlab;
+
+   public:
+    using value_type = T;
+
+    explicit SlabAllocator(Slab<Storage>* slab) : mSlab(slab) {}
+    template<typename U>
+    SlabAllocator(const SlabAllocator<U, Storage>& rhs) : mSlab(rhs.mSlab) {}
+
+    T* allocate(std::size_t n) {
+        static_assert(sizeof(T) <= sizeof(Storage) && alignof(T) <= alignof(Storage), "The slots of the slab are too small");
+        assert(n == 1);
+        return static_cast<T*>(mSlab->allocate());
+    }
+    void deallocate(T* p, [[maybe_unused]] std::size_t n) {
+        assert(n == 1);
+        mSlab->deallocate(p);
+    }
+    /**
+     * Constructs an object in allocated memory. Classes with private constructors can befriend SlabAllocator to be created through it.
+     */
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template<typename U>
+    bool operator==(const SlabAllocator<U, Storage>& rhs) const {
+        return mSlab == rhs.mSlab;
+    }
+    template<typename U>
+    bool operator!=(const SlabAllocator<U, Storage>& rhs) const {
+        return mSlab != rhs.mSlab;
+    }
+};
+
+}  // namespace carl
@@ -7,8 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
-#include <mutex>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -20,6 +20,13 @@
 
 namespace carl {
 
+/**
+ * Accumulates terms of polynomials by their monomials.
+ * Every addition obtains an entry via getId(), adds terms and finally releases the entry with readTerms() or dropTerms().
+ * Free entries are kept on a stack, hence obtaining an entry takes constant time.
+ *
+ * A TermAdditionManager is not thread-safe, every thread has to use its own instance.
+ */
 template<typename Polynomial, typename Ordering>
 class TermAdditionManager {
    public:
@@ -29,29 +36,74 @@ class TermAdditionManager {
     using TermPtr = TermType;
     using TermIDs = std::vector<IDType>;
     using Terms = std::vector<TermPtr>;
+    /**
+     * Open addressing hash table mapping global IDs to local IDs.
+     * Used instead of TermIDs for small additions, as TermIDs has an entry for every monomial id ever handed out.
+     * An entry with global ID zero is empty. Entries are never removed, the local ID is reset to zero instead.
+     */
+    struct HashedTermIDs {
+        std::vector<std::pair<std::size_t, IDType>> table;
+        std::size_t used = 0;
+
+        void reset(std::size_t expectedSize) {
+            std::size_t size = 16;
+            while (size < 2 * expectedSize) size <<= 1;
+            table.assign(size, std::make_pair(std::size_t(0), IDType(0)));
+            used = 0;
+        }
+        IDType& operator[](std::size_t monId) {
+            assert(monId != 0);
+            std::size_t mask = table.size() - 1;
+            std::size_t pos = std::size_t((static_cast<std::uint64_t>(monId) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+            while (table[pos].first != 0) {
+                if (table[pos].first == monId)
+                    return table[pos].second;
+                pos = (pos + 1) & mask;
+            }
+            if (2 * (used + 1) > table.size()) {
+                grow();
+                return (*this)[monId];
+            }
+            ++used;
+            table[pos].first = monId;
+            return table[pos].second;
+        }
+        void grow() {
+            std::vector<std::pair<std::size_t, IDType>> old(2 * table.size(), std::make_pair(std::size_t(0), IDType(0)));
+            std::swap(old, table);
+            used = 0;
+            for (const auto& entry : old) {
+                if (entry.first != 0)
+                    (*this)[entry.first] = entry.second;
+            }
+        }
+    };
     /* 0: Maps global IDs to local IDs.
      * 1: Actual terms by local IDs.
      * 2: Flag if this entry is currently used.
      * 3: Constant part.
      * 4: Next free local ID.
+     * 5: Maps global IDs to local IDs, if hashed.
+     * 6: Flag if 5 is used instead of 0.
      */
-    using Tuple = std::tuple<TermIDs, Terms, bool, Coeff, IDType>;
+    using Tuple = std::tuple<TermIDs, Terms, bool, Coeff, IDType, HashedTermIDs, bool>;
     using TAMId = typename std::list<Tuple>::iterator;
 
+    /**
+     * Number of additions that used either way to map global IDs to local IDs.
+     */
+    struct Statistics {
+        std::size_t dense = 0;
+        std::size_t hashed = 0;
+    };
+    /// An addition is hashed if the dense map would be larger than this factor times the expected size.
+    static constexpr std::size_t HashedFactor = 64;
+
    private:
     std::list<Tuple> mData;
-    TAMId mNextId;
-    mutable std::mutex mMutex;
-
-#ifdef CARL_THREAD_SAFE
-#define TAM_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
-#define TAM_LOCK mMutex.lock();
-#define TAM_UNLOCK mMutex.unlock();
-#else
-#define TAM_LOCK_GUARD
-#define TAM_LOCK
-#define TAM_UNLOCK
-#endif
+    /// Entries that are currently not used.
+    std::vector<TAMId> mFree;
+    Statistics mStatistics;
 
     TAMId createNewEntry() {
         TAMId res = mData.emplace(mData.end());
@@ -59,6 +111,20 @@ class TermAdditionManager {
         return res;
     }
 
+    /**
+     * Retrieves the local ID of the given global ID.
+     */
+    template<bool NewMonomials>
+    IDType& localID(Tuple& data, std::size_t monId) {
+        if (std::get<6>(data)) {
+            return std::get<5>(data)[monId];
+        }
+        TermIDs& termIDs = std::get<0>(data);
+        if (NewMonomials && monId >= termIDs.size())
+            termIDs.resize(monId + 1);
+        return termIDs[monId];
+    }
+
     bool compare(TAMId id, IDType t1, IDType t2) const {
         Tuple& data = *id;
         assert(std::get<2>(data));
@@ -69,21 +135,19 @@ class TermAdditionManager {
    public:
     TermAdditionManager() {
         MonomialPool::getInstance();
-        mNextId = createNewEntry();
+        mFree.push_back(createNewEntry());
     }
 
 #define SWAP_TERMS
 
     TAMId getId(std::size_t expectedSize = 0) {
-        TAM_LOCK_GUARD
-        while (std::get<2>(*mNextId)) {
-            mNextId++;
-            if (mNextId == mData.end()) {
-                mNextId = mData.emplace(mData.end());
-                std::get<4>(*mNextId) = 1;
-            }
+        if (mFree.empty()) {
+            mFree.push_back(createNewEntry());
         }
-        Tuple& data = *mNextId;
+        TAMId result = mFree.back();
+        mFree.pop_back();
+        Tuple& data = *result;
+        assert(!std::get<2>(data));
         Terms& terms = std::get<1>(data);
         terms.clear();
         terms.resize(expectedSize + 1);
@@ -91,16 +155,20 @@ class TermAdditionManager {
 // memset(&terms[0], 0, sizeof(TermPtr)*terms.size());
 #endif
         std::size_t greatestIdPlusOne = MonomialPool::getInstance().largestID() + 1;
-        if (std::get<0>(data).size() < greatestIdPlusOne)
-            std::get<0>(data).resize(greatestIdPlusOne);
+        // Small additions use a hash table instead of touching an entry of a vector for every monomial.
+        std::get<6>(data) = expectedSize > 0 && (expectedSize + 1) * HashedFactor < greatestIdPlusOne;
+        if (std::get<6>(data)) {
+            std::get<5>(data).reset(expectedSize + 1);
+            ++mStatistics.hashed;
+        } else {
+            if (std::get<0>(data).size() < greatestIdPlusOne)
+                std::get<0>(data).resize(greatestIdPlusOne);
+            ++mStatistics.dense;
+        }
         // memset(&std::get<0>(data)[0], 0, sizeof(IDType)*std::get<0>(data).size());
         std::get<3>(data) = constant_zero<Coeff>::get();
         std::get<4>(data) = 1;
         std::get<2>(data) = true;
-        TAMId result = mNextId;
-        mNextId++;
-        if (mNextId == mData.end())
-            mNextId = mData.begin();
         return result;
     }
 
@@ -109,13 +177,10 @@ class TermAdditionManager {
         assert(!term.isZero());
         Tuple& data = *id;
         assert(std::get<2>(data));
-        TermIDs& termIDs = std::get<0>(data);
         Terms& terms = std::get<1>(data);
         if (term.monomial()) {
             std::size_t monId = term.monomial()->id();
-            if (NewMonomials && monId >= termIDs.size())
-                termIDs.resize(monId + 1);
-            IDType locId = termIDs[monId];
+            IDType& locId = localID<NewMonomials>(data, monId);
             if (locId != 0) {
                 if (SizeUnknown && locId >= terms.size())
                     terms.resize(locId + 1);
@@ -124,7 +189,7 @@ class TermAdditionManager {
                 if (!carl::isZero(t.coeff())) {
                     Coeff coeff = t.coeff() + term.coeff();
                     if (carl::isZero(coeff)) {
-                        termIDs[monId] = 0;
+                        locId = 0;
                         t = std::move(TermType());
                     } else {
                         t.coeff() = std::move(coeff);
@@ -137,7 +202,7 @@ class TermAdditionManager {
                     terms.resize(nextID + 1);
                 assert(nextID < terms.size());
                 assert(nextID < std::numeric_limits<IDType>::max());
-                termIDs[monId] = nextID;
+                locId = nextID;
                 terms[nextID] = term;
                 ++nextID;
             }
@@ -146,6 +211,19 @@ class TermAdditionManager {
         }
     }
 
+    /**
+     * @return If the given addition uses a hash table to map global IDs to local IDs.
+     */
+    bool isHashed(TAMId id) const {
+        return std::get<6>(*id);
+    }
+    /**
+     * @return Number of additions that used either way to map global IDs to local IDs.
+     */
+    Statistics statistics() const {
+        return mStatistics;
+    }
+
     TermType getMaxTerm(TAMId id) const {
         Tuple& data = *id;
         Terms& terms = std::get<1>(data);
@@ -182,7 +260,7 @@ class TermAdditionManager {
                     t.pop_back();
                 }
             } else {
-                if ((*i).monomial())
+                if ((*i).monomial() && !std::get<6>(data))
                     termIDs[(*i).monomial()->id()] = 0;
                 ++i;
             }
@@ -198,15 +276,16 @@ class TermAdditionManager {
         ++i;
         for (; i != t.end(); ++i) {
             if (*i) {
-                termIDs[(*i)->monomial()->id()] = 0;
+                if (!std::get<6>(data))
+                    termIDs[(*i)->monomial()->id()] = 0;
                 terms.push_back(*i);
                 *i = nullptr;
             }
         }
         t.clear();
 #endif
-        TAM_LOCK_GUARD
         std::get<2>(data) = false;
+        mFree.push_back(id);
     }
 
     void dropTerms(TAMId id) {
@@ -214,12 +293,14 @@ class TermAdditionManager {
         assert(std::get<2>(data));
         Terms& t = std::get<1>(data);
         TermIDs& termIDs = std::get<0>(data);
-        for (auto i = t.begin(); i != t.end(); i++) {
-            if ((*i).monomial())
-                termIDs[(*i).monomial()->id()] = 0;
+        if (!std::get<6>(data)) {
+            for (auto i = t.begin(); i != t.end(); i++) {
+                if ((*i).monomial())
+                    termIDs[(*i).monomial()->id()] = 0;
+            }
         }
-        TAM_LOCK_GUARD
         std::get<2>(data) = false;
+        mFree.push_back(id);
     }
 };
 
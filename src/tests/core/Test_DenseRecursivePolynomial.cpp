@@ -0,0 +1,72 @@
+#include <carl/core/DenseRecursivePolynomial.h>
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <gtest/gtest.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Dense = DenseRecursivePolynomial<Rational>;
+
+class DenseRecursivePolynomialTest : public testing::Test {
+   protected:
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Poly p = Rational(3) * x * x * x * y - Rational(1, 3) * x * x * z + Poly(x) * y * z * z + Rational(7) * y * y - Poly(z) + Rational(5, 2);
+    Poly q = Poly(x) * x * y * y - Rational(2) * x * z + Poly(y) * y * z - Rational(4);
+};
+
+TEST_F(DenseRecursivePolynomialTest, Conversion) {
+    Dense dp(p, {x, y, z});
+    EXPECT_EQ(std::vector<Variable>({x, y, z}), dp.variables());
+    EXPECT_EQ(3, dp.degree());
+    EXPECT_EQ(p, dp.toMultivariatePolynomial());
+    EXPECT_EQ(p, Dense(p, {z, x, y}).toMultivariatePolynomial());
+    EXPECT_EQ(p.toUnivariatePolynomial(y), Dense(p, {y, x, z}).toUnivariatePolynomial());
+    EXPECT_EQ(dp, Dense(p.toUnivariatePolynomial(x), {y, z}));
+
+    EXPECT_TRUE(Dense(Poly(), {x, y}).isZero());
+    EXPECT_EQ(Poly(), Dense(Poly(), {x, y}).toMultivariatePolynomial());
+    EXPECT_EQ(Poly(Rational(4)), Dense(Poly(Rational(4)), {x, y}).toMultivariatePolynomial());
+}
+
+TEST_F(DenseRecursivePolynomialTest, Arithmetic) {
+    Dense dp(p, {x, y, z});
+    Dense dq(q, {x, y, z});
+    EXPECT_EQ(p + q, (dp + dq).toMultivariatePolynomial());
+    EXPECT_EQ(p - q, (dp - dq).toMultivariatePolynomial());
+    EXPECT_EQ(p * q, (dp * dq).toMultivariatePolynomial());
+    EXPECT_TRUE((dp - dp).isZero());
+    EXPECT_EQ(0, (dp - dp).degree());
+}
+
+TEST_F(DenseRecursivePolynomialTest, Evaluate) {
+    Dense dp(p, {y, z, x});
+    for (int i = -3; i <= 3; ++i) {
+        std::vector<Rational> values = {Rational(2 - i), Rational(i * i) / Rational(5), Rational(i) / Rational(2)};
+        std::map<Variable, Rational> map = {{y, values[0]}, {z, values[1]}, {x, values[2]}};
+        EXPECT_EQ(p.evaluate(map), dp.evaluate(values));
+    }
+}
+
+TEST_F(DenseRecursivePolynomialTest, Resultant) {
+    auto check = [](const Poly& a, const Poly& b, const std::vector<Variable>& vars) {
+        Poly expected(carl::resultant(a.toUnivariatePolynomial(vars.front()), b.toUnivariatePolynomial(vars.front())));
+        EXPECT_EQ(expected, resultant(Dense(a, vars), Dense(b, vars)).toMultivariatePolynomial());
+    };
+    check(p, q, {x, y, z});
+    check(q, p, {x, y, z});
+    check(p, q, {y, x, z});
+    check(p, q, {z, x, y});
+    check(p * q, q, {x, y, z});
+    check(Poly(x) * x - Poly(y), Poly(x) * y - Rational(1), {x, y});
+    check(Poly(x) * x * x - Rational(2), Poly(x) * x + Rational(3), {x});
+    check(Poly(x) * y - Rational(1), Poly(y) + Rational(2), {x, y});
+
+    // The resultant of a constant c and a polynomial of degree n is c^n.
+    Poly c = Poly(y) + Rational(2);
+    EXPECT_EQ(c * c * c, resultant(Dense(c, {x, y}), Dense(Poly(x) * x * x + Poly(y), {x, y})).toMultivariatePolynomial());
+}
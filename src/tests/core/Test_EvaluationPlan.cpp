@@ -0,0 +1,137 @@
+#include <carl/core/EvaluationPlan.h>
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/interval/Interval.h>
+#include <gtest/gtest.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+class EvaluationPlanTest : public testing::Test {
+   protected:
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Poly p = Rational(3) * x * x * x * y - Rational(1, 3) * x * x * z + Poly(x) * y * z * z + Rational(7) * y * y - Poly(z) + Rational(5, 2);
+};
+
+TEST_F(EvaluationPlanTest, Rational) {
+    EvaluationPlan<Rational> plan(p);
+    EXPECT_EQ(std::vector<Variable>({x, y, z}), plan.variables());
+    std::vector<Rational> registers;
+    for (int i = -3; i <= 3; ++i) {
+        std::vector<Rational> values = {Rational(i) / Rational(2), Rational(2 - i), Rational(i * i) / Rational(5)};
+        std::map<Variable, Rational> map = {{x, values[0]}, {y, values[1]}, {z, values[2]}};
+        EXPECT_EQ(p.evaluate(map), plan.evaluate(values, registers));
+    }
+
+    EXPECT_EQ(Rational(0), EvaluationPlan<Rational>(Poly()).evaluate({}));
+    EXPECT_EQ(Rational(4), EvaluationPlan<Rational>(Poly(Rational(4))).evaluate({}));
+}
+
+TEST_F(EvaluationPlanTest, VariableOrder) {
+    Variable w = freshRealVariable("w");
+    EvaluationPlan<Rational> plan(p, {z, w, y, x});
+    std::map<Variable, Rational> map = {{x, Rational(2)}, {y, Rational(-1)}, {z, Rational(1, 2)}};
+    EXPECT_EQ(p.evaluate(map), plan.evaluate({Rational(1, 2), Rational(100), Rational(-1), Rational(2)}));
+}
+
+TEST_F(EvaluationPlanTest, SharedPowers) {
+    // x^2 is used by both terms, only a single power is computed.
+    Poly q = Poly(x) * x * y + Poly(x) * x * z;
+    EvaluationPlan<Rational> plan(q);
+    EXPECT_EQ(Rational(2 * 2 * 3 + 2 * 2 * 5), plan.evaluate({Rational(2), Rational(3), Rational(5)}));
+    // x^2 * (y + z)
+    EXPECT_EQ(3, plan.size());
+}
+
+TEST_F(EvaluationPlanTest, Double) {
+    EvaluationPlan<double> plan(p);
+    std::map<Variable, Rational> map = {{x, Rational(1, 4)}, {y, Rational(-3)}, {z, Rational(5, 8)}};
+    EXPECT_DOUBLE_EQ(toDouble(p.evaluate(map)), plan.evaluate({0.25, -3.0, 0.625}));
+}
+
+TEST_F(EvaluationPlanTest, Interval) {
+    std::map<Variable, Rational> map = {{x, Rational(1, 4)}, {y, Rational(-3)}, {z, Rational(5, 8)}};
+    Rational value = p.evaluate(map);
+
+    EvaluationPlan<Interval<Rational>> exact(p);
+    EXPECT_EQ(Interval<Rational>(value), exact.evaluate({Interval<Rational>(Rational(1, 4)), Interval<Rational>(Rational(-3)), Interval<Rational>(Rational(5, 8))}));
+
+    EvaluationPlan<Interval<double>> plan(p);
+    Interval<double> res = plan.evaluate({Interval<double>(0.25), Interval<double>(-3.0), Interval<double>(0.625)});
+    EXPECT_TRUE(res.contains(toDouble(value)));
+
+    Interval<double> range = plan.evaluate({Interval<double>(-1.0, 1.0), Interval<double>(0.0, 2.0), Interval<double>(-0.5, 0.5)});
+    for (double vx : {-1.0, 0.0, 1.0}) {
+        for (double vy : {0.0, 1.0, 2.0}) {
+            for (double vz : {-0.5, 0.5}) {
+                map = {{x, carl::rationalize<Rational>(vx)}, {y, carl::rationalize<Rational>(vy)}, {z, carl::rationalize<Rational>(vz)}};
+                EXPECT_TRUE(range.contains(toDouble(p.evaluate(map))));
+            }
+        }
+    }
+}
+
+TEST_F(EvaluationPlanTest, Batch) {
+    std::vector<std::vector<Rational>> values(3);
+    std::vector<std::vector<double>> doubles(3);
+    std::vector<std::vector<Interval<double>>> intervals(3);
+    for (int i = -4; i <= 4; ++i) {
+        std::vector<Rational> point = {Rational(i) / Rational(2), Rational(2 - i), Rational(i * i) / Rational(8)};
+        for (std::size_t v = 0; v < 3; ++v) {
+            values[v].push_back(point[v]);
+            doubles[v].push_back(toDouble(point[v]));
+            intervals[v].push_back(Interval<double>(toDouble(point[v])));
+        }
+    }
+    std::vector<Rational> res = p.evaluateBatch({x, y, z}, values);
+    std::vector<double> dres = EvaluationPlan<double>(p).evaluateBatch(doubles);
+    std::vector<Interval<double>> ires = EvaluationPlan<Interval<double>>(p).evaluateBatch(intervals);
+    ASSERT_EQ(values[0].size(), res.size());
+    ASSERT_EQ(values[0].size(), dres.size());
+    ASSERT_EQ(values[0].size(), ires.size());
+    for (std::size_t j = 0; j < res.size(); ++j) {
+        std::map<Variable, Rational> map = {{x, values[0][j]}, {y, values[1][j]}, {z, values[2][j]}};
+        EXPECT_EQ(p.evaluate(map), res[j]);
+        EXPECT_DOUBLE_EQ(toDouble(res[j]), dres[j]);
+        EXPECT_TRUE(ires[j].contains(toDouble(res[j])));
+    }
+
+    // More points than fit into a single block.
+    std::vector<std::vector<double>> many(3);
+    for (std::size_t j = 0; j < 1000; ++j) {
+        for (std::size_t v = 0; v < 3; ++v) {
+            many[v].push_back(doubles[v][j % doubles[v].size()]);
+        }
+    }
+    dres = EvaluationPlan<double>(p).evaluateBatch(many);
+    ASSERT_EQ(1000, dres.size());
+    for (std::size_t j = 0; j < dres.size(); ++j) {
+        EXPECT_DOUBLE_EQ(toDouble(res[j % res.size()]), dres[j]);
+    }
+
+    EXPECT_EQ(std::vector<Rational>(4, Rational(3)), EvaluationPlan<Rational>(Poly(Rational(3))).evaluateBatch({}, 4));
+    EXPECT_EQ(values[1], Poly(y).evaluateBatch({x, y, z}, values));
+}
+
+TEST_F(EvaluationPlanTest, BatchAgreesWithEvaluate) {
+    // High powers of inexact values, such that different ways to compute the powers are likely to round differently.
+    Poly q = Poly(x).pow(13) * y + Rational(3) * Poly(y).pow(7) - Poly(x).pow(5) * Poly(z).pow(11);
+    EvaluationPlan<double> plan(q);
+    // An odd number of points, hence the last point is not processed together with another one.
+    std::vector<std::vector<double>> values(3);
+    for (std::size_t j = 0; j < 11; ++j) {
+        values[0].push_back(1.1 + 0.137 * double(j));
+        values[1].push_back(-0.3 - 0.071 * double(j));
+        values[2].push_back(0.9 + 0.013 * double(j));
+    }
+    std::vector<double> res = plan.evaluateBatch(values);
+    ASSERT_EQ(values[0].size(), res.size());
+    std::vector<double> registers;
+    for (std::size_t j = 0; j < res.size(); ++j) {
+        EXPECT_EQ(plan.evaluate({values[0][j], values[1][j], values[2][j]}, registers), res[j]);
+    }
+}
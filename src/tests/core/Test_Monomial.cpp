@@ -1,9 +1,13 @@
 #include <carl/core/Monomial.h>
 #include <carl/core/MonomialPool.h>
+#include <carl/core/MultivariatePolynomial.h>
 #include <carl/core/Variable.h>
+#include <carl/core/VariablePool.h>
 #include <gtest/gtest.h>
 #include <boost/variant.hpp>
+#include <algorithm>
 #include <list>
+#include <vector>
 
 #include "../Common.h"
 
@@ -229,3 +233,118 @@ TEST(Monomial, CalcLCM) {
     carl::Monomial::Arg m2 = x * x * y;
     EXPECT_EQ(y, carl::Monomial::calcLcmAndDivideBy(m1, m2));
 }
+
+namespace {
+carl::CompareResult referenceLexicalCompare(const carl::Monomial::Content& lhs, const carl::Monomial::Content& rhs) {
+    auto lit = lhs.begin();
+    auto rit = rhs.begin();
+    for (; lit != lhs.end(); ++lit, ++rit) {
+        if (rit == rhs.end())
+            return carl::CompareResult::GREATER;
+        if (lit->first != rit->first)
+            return (lit->first < rit->first) ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+        if (lit->second != rit->second)
+            return (lit->second > rit->second) ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+    }
+    return (rit == rhs.end()) ? carl::CompareResult::EQUAL : carl::CompareResult::LESS;
+}
+}  // namespace
+
+TEST(Monomial, PackedOperations) {
+    // Only variables with small ids are packed.
+    carl::VariablePool::getInstance().clear();
+    // Exponents of 128 and more can not be packed, hence both representations are used.
+    std::vector<carl::Variable> vars = {carl::freshRealVariable("x"), carl::freshRealVariable("y"), carl::freshRealVariable("z")};
+    std::vector<carl::uint> exps = {0, 1, 2, 5, 127, 128};
+    std::vector<carl::Monomial::Arg> monomials;
+    for (auto e0 : exps) {
+        for (auto e1 : exps) {
+            for (auto e2 : exps) {
+                carl::Monomial::Arg m;
+                if (e0 > 0)
+                    m = m * carl::createMonomial(vars[0], e0);
+                if (e1 > 0)
+                    m = m * carl::createMonomial(vars[1], e1);
+                if (e2 > 0)
+                    m = m * carl::createMonomial(vars[2], e2);
+                if (m) {
+                    EXPECT_EQ(std::max({e0, e1, e2}) <= carl::PackedExponents::MaxExponent, m->packedExponents().packed());
+                    monomials.push_back(m);
+                }
+            }
+        }
+    }
+    for (const auto& lhs : monomials) {
+        for (const auto& rhs : monomials) {
+            bool divisible = true;
+            carl::Monomial::Content lcm;
+            carl::Monomial::Content gcd;
+            for (auto v : vars) {
+                carl::uint l = lhs->exponentOfVariable(v);
+                carl::uint r = rhs->exponentOfVariable(v);
+                divisible = divisible && l >= r;
+                lcm.emplace_back(v, std::max(l, r));
+                if (std::min(l, r) > 0)
+                    gcd.emplace_back(v, std::min(l, r));
+            }
+            lcm.erase(std::remove_if(lcm.begin(), lcm.end(), [](const auto& ve) { return ve.second == 0; }), lcm.end());
+            EXPECT_EQ(divisible, lhs->divisible(rhs));
+            carl::Monomial::Arg quotient;
+            EXPECT_EQ(divisible, lhs->divide(rhs, quotient));
+            EXPECT_EQ(lcm, carl::Monomial::lcm(lhs, rhs)->exponents());
+            if (gcd.empty()) {
+                EXPECT_EQ(nullptr, carl::Monomial::gcd(lhs, rhs));
+            } else {
+                EXPECT_EQ(gcd, carl::Monomial::gcd(lhs, rhs)->exponents());
+            }
+            EXPECT_EQ(referenceLexicalCompare(lhs->exponents(), rhs->exponents()), carl::Monomial::lexicalCompare(*lhs, *rhs));
+        }
+    }
+}
+
+TEST(Monomial, PackedMixedTypes) {
+    // Variables of different types may have the same id.
+    carl::VariablePool::getInstance().clear();
+    carl::Variable x = carl::freshRealVariable("x");
+    carl::Variable n = carl::freshIntegerVariable("n");
+    while (n.id() < x.id()) {
+        n = carl::freshIntegerVariable("n");
+    }
+    ASSERT_EQ(x.id(), n.id());
+    carl::Monomial::Arg x2 = carl::createMonomial(x, 2);
+    carl::Monomial::Arg n2 = carl::createMonomial(n, 2);
+    EXPECT_TRUE(x2->packedExponents().packed());
+    EXPECT_FALSE(n2->packedExponents().packed());
+    EXPECT_FALSE(x2->divisible(carl::createMonomial(n, 1)));
+    EXPECT_FALSE(n2->divisible(carl::createMonomial(x, 1)));
+    EXPECT_NE(carl::CompareResult::EQUAL, carl::Monomial::lexicalCompare(*x2, *n2));
+    EXPECT_NE(x2, n2);
+    EXPECT_EQ(2, (x2 * n2)->exponents().size());
+
+    using Pol = carl::MultivariatePolynomial<Rational>;
+    Pol p = Pol(x) * x + Pol(n) * n;
+    EXPECT_EQ(2, p.nrTerms());
+    EXPECT_EQ(2, p.degree(x));
+    EXPECT_EQ(2, p.degree(n));
+}
+
+TEST(Monomial, DivisibleManyVariables) {
+    // The variable signatures of monomials in more than 64 variables collide.
+    std::vector<carl::Variable> vars;
+    for (std::size_t i = 0; i < 130; ++i) {
+        vars.push_back(carl::freshRealVariable("v" + std::to_string(i)));
+    }
+    for (std::size_t i = 0; i + 64 < vars.size(); ++i) {
+        carl::Monomial::Arg m1 = vars[i] * vars[i + 64];
+        carl::Monomial::Arg m2 = carl::createMonomial(vars[i + 64], 2);
+        EXPECT_TRUE(m1->divisible(carl::createMonomial(vars[i], 1)));
+        EXPECT_TRUE(m1->divisible(carl::createMonomial(vars[i + 64], 1)));
+        EXPECT_FALSE(m1->divisible(m2));
+        EXPECT_FALSE(m2->divisible(carl::createMonomial(vars[i], 1)));
+        EXPECT_FALSE(carl::createMonomial(vars[i], 2)->divisible(m1));
+        carl::Monomial::Arg res;
+        EXPECT_TRUE(m1->divide(carl::createMonomial(vars[i + 64], 1), res));
+        EXPECT_EQ(carl::createMonomial(vars[i], 1), res);
+        EXPECT_FALSE(m2->divide(carl::createMonomial(vars[i], 1), res));
+    }
+}
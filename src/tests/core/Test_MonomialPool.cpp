@@ -1,6 +1,16 @@
 #include "gtest/gtest.h"
 
 #include "carl/core/MonomialPool.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+
+#include "../Common.h"
+
+#include <atomic>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 using namespace carl;
 
@@ -22,8 +32,248 @@ TEST(MonomialPool, clear) {
         EXPECT_GT(pool.size(), 0);
     }
 
+    auto kept = createMonomial(x, 5);
+    pool.resetStatistics();
+    std::size_t size = pool.size();
     pool.clear();
     EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(pool.largestID(), 0);
+    EXPECT_EQ(pool.statistics().freed, size);
     auto m = createMonomial(x, 3);
     EXPECT_EQ(pool.size(), 1);
+    EXPECT_LE(m->id(), pool.largestID());
+
+    // Monomials that were dropped by clear() are not counted again and do not release ids of the new monomials.
+    auto recreated = createMonomial(x, 5);
+    kept = nullptr;
+    EXPECT_EQ(pool.statistics().freed, size);
+    EXPECT_EQ(pool.size(), 2);
+    auto other = createMonomial(x, 6);
+    EXPECT_NE(other->id(), recreated->id());
+    EXPECT_NE(other->id(), m->id());
+}
+
+TEST(MonomialPool, statistics) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    pool.resetStatistics();
+    auto before = pool.statistics();
+    EXPECT_EQ(before.created, 0);
+    EXPECT_EQ(before.live, pool.size());
+    EXPECT_EQ(before.peak, before.live);
+
+    std::vector<Monomial::Arg> monomials;
+    for (exponent e = 1; e <= 10; ++e) {
+        monomials.push_back(createMonomial(x, e));
+    }
+    pool.setCreationCacheSize(0);
+    auto m = createMonomial(x, 1);
+    pool.setCreationCacheSize(256);
+    auto stats = pool.statistics();
+    EXPECT_EQ(stats.created, 10);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.live, before.live + 10);
+    EXPECT_EQ(stats.peak, stats.live);
+    EXPECT_GE(stats.contentBytes, 10 * sizeof(Monomial::Content::value_type));
+    EXPECT_GT(stats.buckets, 0);
+    EXPECT_GE(stats.maxBucketSize, 1);
+    EXPECT_GE(stats.largestID, monomials.back()->id());
+
+    monomials.clear();
+    m = nullptr;
+#ifndef CARL_PRUNE_MONOMIAL_POOL
+    pool.collect();
+#endif
+    stats = pool.statistics();
+    EXPECT_GE(stats.freed, 10);
+    EXPECT_LE(stats.live, stats.peak - 10);
+    std::stringstream ss;
+    ss << stats;
+    EXPECT_FALSE(ss.str().empty());
+}
+
+TEST(MonomialPool, creationCache) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    std::size_t size = pool.creationCacheSize();
+
+    MonomialPool::resetCreationCacheStatistics();
+    auto m1 = createMonomial(x, 5);
+    auto m2 = createMonomial(x, 5);
+    EXPECT_EQ(m1.get(), m2.get());
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().misses, 1);
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().hits, 1);
+    auto m3 = createMonomial(x, 2) * createMonomial(y, 3);
+    auto m4 = createMonomial(x, 2) * createMonomial(y, 3);
+    EXPECT_EQ(m3.get(), m4.get());
+#ifdef CARL_PRUNE_MONOMIAL_POOL
+    // The factors were released in between, only the product is found.
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().hits, 2);
+#else
+    // The factors are kept by the pool until the end of the epoch.
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().hits, 4);
+#endif
+
+    pool.setCreationCacheSize(0);
+    MonomialPool::resetCreationCacheStatistics();
+    auto m5 = createMonomial(x, 5);
+    EXPECT_EQ(m1.get(), m5.get());
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().hits, 0);
+    EXPECT_EQ(MonomialPool::creationCacheStatistics().misses, 0);
+
+    pool.setCreationCacheSize(size);
+    EXPECT_EQ(pool.creationCacheSize(), size);
+}
+
+TEST(MonomialPool, productCache) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    std::size_t size = pool.productCacheSize();
+    pool.setProductCacheSize(1000);
+    EXPECT_EQ(pool.productCacheSize(), 1024);
+
+    MonomialPool::resetProductCacheStatistics();
+    auto a = createMonomial(x, 1) * createMonomial(y, 2);
+    auto b = createMonomial(y, 1) * createMonomial(z, 3);
+    auto ab = a * b;
+    EXPECT_EQ(ab.get(), (b * a).get());
+    EXPECT_EQ(ab.get(), (a * b).get());
+    EXPECT_EQ(MonomialPool::productCacheStatistics().hits, 2);
+
+    // After b is destructed, its id may be reused by a different monomial.
+    std::size_t id = b->id();
+    b = nullptr;
+    auto c = createMonomial(x, 2) * createMonomial(z, 1);
+    auto ac = a * c;
+    EXPECT_EQ(ac->exponents(), (Monomial::Content{{x, 3}, {y, 2}, {z, 1}}));
+    EXPECT_TRUE(c->id() != id || MonomialPool::productCacheStatistics().hits == 2);
+
+    // Products of polynomials do not depend on the cache.
+    using Poly = MultivariatePolynomial<Rational>;
+    auto polys = benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3);
+    std::vector<Poly> cached;
+    for (const auto& p : polys) {
+        for (const auto& q : polys) {
+            cached.push_back(p * q * p);
+        }
+    }
+    EXPECT_GT(MonomialPool::productCacheStatistics().hits, 2);
+    pool.setProductCacheSize(0);
+    std::size_t i = 0;
+    for (const auto& p : polys) {
+        for (const auto& q : polys) {
+            EXPECT_EQ(cached[i++], p * q * p);
+        }
+    }
+
+    pool.setProductCacheSize(size);
+}
+
+#ifndef CARL_PRUNE_MONOMIAL_POOL
+TEST(MonomialPool, collect) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    pool.collect();
+    std::size_t size = pool.size();
+
+    auto kept = createMonomial(x, 2) * createMonomial(y, 1);
+    EXPECT_EQ(pool.size(), size + 3);
+    {
+        auto tmp = createMonomial(x, 7);
+    }
+    // Unused monomials are only reclaimed at the end of an epoch.
+    EXPECT_EQ(pool.size(), size + 4);
+    EXPECT_EQ(pool.collect(), 3);
+    EXPECT_EQ(pool.size(), size + 1);
+
+    EXPECT_EQ(kept.get(), (createMonomial(x, 2) * createMonomial(y, 1)).get());
+    auto other = createMonomial(y, 7);
+    EXPECT_NE(kept->id(), other->id());
+    EXPECT_EQ(other->exponents(), (Monomial::Content{{y, 7}}));
+}
+#endif
+
+#ifdef CARL_THREAD_SAFE
+TEST(MonomialPool, concurrentCreation) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    constexpr std::size_t threads = 8;
+    constexpr exponent maxExp = 12;
+
+    // Every thread creates the same monomials, partly by multiplication, and releases some of them on the way.
+    std::vector<std::vector<Monomial::Arg>> results(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (exponent i = 1; i <= maxExp; ++i) {
+                for (exponent j = 1; j <= maxExp; ++j) {
+                    auto tmp = createMonomial(z, i + j + exponent(t));
+                    auto m = createMonomial(x, i) * createMonomial(y, j);
+                    results[t].push_back(m);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    std::set<std::size_t> ids;
+    for (std::size_t i = 0; i < results[0].size(); ++i) {
+        for (std::size_t t = 1; t < threads; ++t) {
+            EXPECT_EQ(results[0][i].get(), results[t][i].get());
+        }
+        EXPECT_NE(results[0][i]->id(), 0);
+        EXPECT_LE(results[0][i]->id(), pool.largestID());
+        ids.insert(results[0][i]->id());
+    }
+    EXPECT_EQ(ids.size(), results[0].size());
+}
+#endif
+
+#if defined(CARL_THREAD_SAFE) && !defined(CARL_PRUNE_MONOMIAL_POOL)
+TEST(MonomialPool, concurrentCollect) {
+    MonomialPool& pool = MonomialPool::getInstance();
+    Variable x = freshRealVariable("x");
+    constexpr std::size_t threads = 4;
+    constexpr exponent maxExp = 64;
+
+    // The monomials are unused between the rounds, hence they are reclaimed while the creation caches of other threads still refer to them.
+    std::vector<std::vector<Monomial::Arg>> results(threads);
+    std::atomic<std::size_t> finished = 0;
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (std::size_t round = 0; round < 200; ++round) {
+                results[t].clear();
+                for (exponent e = 1; e <= maxExp; ++e) {
+                    results[t].push_back(createMonomial(x, e));
+                }
+            }
+            ++finished;
+        });
+    }
+    while (finished < threads) {
+        pool.collect();
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    std::set<std::size_t> ids;
+    for (std::size_t i = 0; i < results[0].size(); ++i) {
+        for (std::size_t t = 1; t < threads; ++t) {
+            EXPECT_EQ(results[0][i].get(), results[t][i].get());
+        }
+        EXPECT_EQ(results[0][i].get(), createMonomial(x, exponent(i + 1)).get());
+        ids.insert(results[0][i]->id());
+    }
+    EXPECT_EQ(ids.size(), results[0].size());
 }
+#endif
@@ -1,4 +1,5 @@
 #include <list>
+#include <thread>
 #include "carl/converter/OldGinacConverter.h"
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/core/VariablePool.h"
@@ -645,3 +646,297 @@ TEST(MultivariatePolynomialTest, Definiteness) {
                                          (Rational)55312 * y * z, (Rational)100000 * z * z});
     EXPECT_TRUE(p5.definiteness() == Definiteness::POSITIVE_SEMI);
 }
+
+TEST(MultivariatePolynomialTest, MultiplicationStrategies) {
+    using Poly = MultivariatePolynomial<Rational>;
+    using Strategy = Poly::MultiplicationStrategy;
+    Variable w = freshRealVariable("w");
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Poly a = Poly(w) + Rational(2) * x - Rational(3) * y + z + Rational(1);
+    Poly b = Poly(w) - x + Rational(5) * y * z - Rational(1, 2);
+    Poly p = a * a * a * a;
+    Poly q = b * b * b;
+    Poly r = Rational(7) * x - Rational(3) * z * z * w + Rational(2);
+
+    std::vector<std::pair<Poly, Poly>> operands = {{p, q}, {q, p}, {p, r}, {r, p}, {p, p}, {Poly(x) + y, Poly(x) - y}};
+    for (const auto& ops : operands) {
+        Poly expected = ops.first;
+        expected.multiply(ops.second, Strategy::TermAddition);
+        for (auto strategy : {Strategy::Heap, Strategy::Geobucket, Strategy::Kronecker, Strategy::Automatic}) {
+            Poly res = ops.first;
+            res.multiply(ops.second, strategy);
+            EXPECT_EQ(expected, res);
+            EXPECT_TRUE(res.isConsistent());
+            if (strategy == Strategy::Heap || strategy == Strategy::Geobucket) {
+                EXPECT_TRUE(res.isOrdered());
+            }
+        }
+    }
+    // Constant, cancelling and aliased operands.
+    for (auto strategy : {Strategy::TermAddition, Strategy::Heap, Strategy::Geobucket, Strategy::Kronecker}) {
+        Poly res = p;
+        res.multiply(q - q + Rational(1), strategy);
+        EXPECT_EQ(p, res);
+        res = Poly(x) + y;
+        res.multiply(Poly(x) - y, strategy);
+        EXPECT_EQ(Poly(x) * x - Poly(y) * y, res);
+        res = p;
+        res.multiply(res, strategy);
+        EXPECT_EQ(p * p, res);
+    }
+
+    EXPECT_EQ(Strategy::TermAddition, Poly::multiplicationStrategy(5, 10));
+    EXPECT_EQ(Strategy::Kronecker, Poly::multiplicationStrategy(10, 20));
+    EXPECT_EQ(Strategy::Kronecker, Poly::multiplicationStrategy(100, 200));
+}
+
+TEST(MultivariatePolynomialTest, KroneckerMultiplication) {
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    {
+        using Poly = MultivariatePolynomial<mpz_class>;
+        using Strategy = Poly::MultiplicationStrategy;
+        mpz_class big("123456789012345678901234567890");
+        Poly a = (Poly(x) * big - Poly(y) * mpz_class(3) + Poly(z) * z + mpz_class(1)).pow(4);
+        Poly b = (Poly(x) * x - Poly(y) * big * big - mpz_class(7)).pow(3);
+        Poly expected = a;
+        expected.multiply(b, Strategy::Heap);
+        Poly res = a;
+        res.multiply(b, Strategy::Kronecker);
+        EXPECT_EQ(expected, res);
+        EXPECT_TRUE(res.isConsistent());
+        // The product cancels completely.
+        res = Poly(x) + y;
+        res.multiply(Poly(x) - y, Strategy::Kronecker);
+        EXPECT_EQ(Poly(x) * x - Poly(y) * y, res);
+    }
+    {
+        using Poly = MultivariatePolynomial<Rational>;
+        using Strategy = Poly::MultiplicationStrategy;
+        Poly a = (Poly(x) * Rational(1, 3) - Poly(y) * Rational(5, 2) + Rational(1, 7)).pow(5);
+        Poly b = (Poly(x) * y - Poly(z) * Rational(2, 9) - Rational(3)).pow(4);
+        Poly expected = a;
+        expected.multiply(b, Strategy::Heap);
+        Poly res = a;
+        res.multiply(b, Strategy::Kronecker);
+        EXPECT_EQ(expected, res);
+        // Sparse products are not substituted.
+        Poly s = Poly(x).pow(100) + Poly(y).pow(90) * z + Poly(z).pow(80);
+        expected = s;
+        expected.multiply(s, Strategy::Heap);
+        res = s;
+        res.multiply(s, Strategy::Kronecker);
+        EXPECT_EQ(expected, res);
+    }
+}
+
+TEST(MultivariatePolynomialTest, PowerStrategies) {
+    using Poly = MultivariatePolynomial<Rational>;
+    using Strategy = Poly::PowerStrategy;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Poly sparse = Poly(x) + y + z + Rational(1);
+    Poly dense(Rational(1));
+    for (exponent e = 1; e <= 10; ++e) {
+        dense += Term<Rational>(Rational(1), x, e);
+    }
+    std::vector<Poly> bases = {sparse,
+                               Poly(x) - y,
+                               Rational(2) * x * y - Rational(1, 3) * z * z + Rational(5),
+                               Poly(x) * x + Rational(-1) * x + Rational(1),
+                               dense};
+    for (const auto& base : bases) {
+        for (std::size_t exp : {0, 1, 2, 3, 7, 8}) {
+            Poly expected = base.naive_pow(unsigned(exp));
+            for (auto strategy : {Strategy::Multiplication, Strategy::Squaring, Strategy::Multinomial, Strategy::Automatic}) {
+                Poly res = base.pow(exp, strategy);
+                EXPECT_EQ(expected, res);
+                EXPECT_TRUE(res.isConsistent());
+            }
+        }
+    }
+    EXPECT_EQ(Poly(Rational(16)) * x * x * x * x, (Rational(2) * Poly(x)).pow(4));
+
+    EXPECT_EQ(Strategy::Multinomial, sparse.powerStrategy(20));
+    EXPECT_EQ(Strategy::Squaring, dense.powerStrategy(20));
+    EXPECT_EQ(1771, sparse.pow(20).nrTerms());
+    EXPECT_EQ(201, dense.pow(20).nrTerms());
+
+    // Too large expansions fall back to squaring.
+    EXPECT_EQ(dense.pow(64, Strategy::Squaring), dense.pow(64, Strategy::Multinomial));
+    Poly binomial = Poly(x) + Rational(1);
+    EXPECT_EQ(binomial.pow(1025, Strategy::Squaring), binomial.pow(1025, Strategy::Multinomial));
+}
+
+TEST(MultivariatePolynomialTest, SimultaneousSubstitute) {
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Variable w = freshRealVariable("w");
+    Poly p = Rational(3) * x * x * y * y * z - Rational(1, 2) * x * x * y * y * w + Poly(x) * x * x * z * z + Rational(2) * y * w - Poly(z) + Rational(7);
+    Poly vx = Rational(1, 2) * w - Rational(3);
+    Poly vy = Poly(w) * w + Rational(1);
+
+    std::map<Variable, Poly> substitutions = {{x, vx}, {y, vy}};
+    Poly expected = p;
+    expected.substituteIn(x, vx);
+    expected.substituteIn(y, vy);
+    Poly res = p.substitute(substitutions);
+    EXPECT_EQ(expected, res);
+    EXPECT_TRUE(res.isConsistent());
+
+    // Substituted values are not substituted again.
+    substitutions = {{x, Poly(y)}, {y, Poly(x)}};
+    EXPECT_EQ(Poly(x) * y + Poly(y) * y, (Poly(y) * x + Poly(x) * x).substitute(substitutions));
+
+    // A zero value eliminates all terms containing its variable.
+    substitutions = {{x, Poly()}, {y, vy}};
+    expected = Rational(2) * vy * w - Poly(z) + Rational(7);
+    EXPECT_EQ(expected, p.substitute(substitutions));
+    substitutions = {{x, Poly(Rational(1))}, {z, Poly()}};
+    EXPECT_EQ(Rational(-1, 2) * Poly(y) * y * w + Rational(2) * y * w + Rational(7), p.substitute(substitutions));
+    substitutions = {{z, Poly()}, {w, Poly()}};
+    EXPECT_EQ(Poly(Rational(7)), p.substitute(substitutions));
+}
+
+TEST(MultivariatePolynomialTest, TemporaryOperands) {
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    const Poly a = Poly(x) * x + Rational(2) * y - Rational(1);
+    const Poly b = Poly(y) * x - Rational(3);
+    const Term<Rational> t(Rational(-2, 3), y, 2);
+    auto copy = [](const Poly& p) { return Poly(p); };
+
+    EXPECT_EQ(a + b, copy(a) + b);
+    EXPECT_EQ(a + b, a + copy(b));
+    EXPECT_EQ(a + b, copy(a) + copy(b));
+    EXPECT_EQ(a + t, copy(a) + t);
+    EXPECT_EQ(a + x, x + copy(a));
+    EXPECT_EQ(a + Rational(5), Rational(5) + copy(a));
+
+    EXPECT_EQ(a - b, copy(a) - b);
+    EXPECT_EQ(a - b, a - copy(b));
+    EXPECT_EQ(a - b, copy(a) - copy(b));
+    EXPECT_EQ(t - a, t - copy(a));
+    EXPECT_EQ(Rational(1) - a, Rational(1) - copy(a));
+    EXPECT_EQ(-a, -copy(a));
+
+    EXPECT_EQ(a * b, copy(a) * b);
+    EXPECT_EQ(a * b, a * copy(b));
+    EXPECT_EQ(a * b, copy(a) * copy(b));
+    EXPECT_EQ(a * Poly(t), copy(a) * t);
+    EXPECT_EQ(a * Poly(t), t * a);
+    EXPECT_EQ(a * Poly(x), x * copy(a));
+    EXPECT_EQ(Rational(0) * a, Poly());
+    EXPECT_EQ(Term<Rational>(Rational(0), x, 1) * copy(a), Poly());
+
+    Poly chain = a * b + b * a - a;
+    EXPECT_EQ(Rational(2) * (a * b) - a, chain);
+    EXPECT_TRUE(chain.isConsistent());
+}
+
+TEST(MultivariatePolynomialTest, FusedProducts) {
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    const Poly a = Poly(x) * x + Rational(2) * y - Rational(1);
+    const Poly b = Poly(y) * x - Rational(3);
+    const Poly c = Rational(1, 2) * Poly(x) * y + Rational(4);
+    const Term<Rational> t(Rational(-2, 3), y, 2);
+
+    Poly p = c;
+    p.addProduct(a, b);
+    EXPECT_EQ(c + a * b, p);
+    p.subtractProduct(a, b);
+    EXPECT_EQ(c, p);
+    p.addProduct(t, a);
+    EXPECT_EQ(c + a * t, p);
+    p.subtractProduct(t, a);
+    EXPECT_EQ(c, p);
+    EXPECT_TRUE(p.isConsistent());
+
+    // Cancellation of all terms and zero operands.
+    p = a * b;
+    p.subtractProduct(b, a);
+    EXPECT_TRUE(p.isZero());
+    p.addProduct(a, Poly());
+    EXPECT_TRUE(p.isZero());
+    p.subtractProduct(t, a);
+    EXPECT_EQ(-(a * t), p);
+    p = Poly();
+    p.subtractProduct(Term<Rational>(Rational(2)), b);
+    EXPECT_EQ(Rational(-2) * b, p);
+}
+
+TEST(MultivariatePolynomialTest, CachedVariables) {
+    using Poly = MultivariatePolynomial<Rational>;
+    using Degrees = std::vector<std::pair<Variable, std::size_t>>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    Poly p = Poly(x) * x * y + Rational(3) * y - Rational(1);
+    EXPECT_EQ(Degrees({{x, 2}, {y, 1}}), p.variableDegrees());
+    EXPECT_EQ(std::set<Variable>({x, y}), p.gatherVariables());
+    EXPECT_TRUE(p.has(x));
+    EXPECT_FALSE(p.has(z));
+    EXPECT_EQ(2, p.degree(x));
+    EXPECT_EQ(0, p.degree(z));
+    EXPECT_FALSE(p.isUnivariate());
+
+    // Every change of the terms drops the cached variables.
+    Poly q = p;
+    q += Poly(z) * z * z;
+    EXPECT_EQ(Degrees({{x, 2}, {y, 1}, {z, 3}}), q.variableDegrees());
+    EXPECT_EQ(Degrees({{x, 2}, {y, 1}}), p.variableDegrees());
+    q -= Poly(z) * z * z;
+    EXPECT_EQ(p, q);
+    EXPECT_FALSE(q.has(z));
+    q *= Poly(y) * y;
+    EXPECT_EQ(3, q.degree(y));
+    q.substituteIn(y, Poly(z));
+    EXPECT_EQ(Degrees({{x, 2}, {z, 3}}), q.variableDegrees());
+    q.subtractProduct(Term<Rational>(Rational(1), z, 3), Poly(x) * x + Rational(3));
+    EXPECT_EQ(Degrees({{z, 2}}), q.variableDegrees());
+    EXPECT_TRUE(q.isUnivariate());
+    q *= Rational(0);
+    EXPECT_TRUE(q.variableDegrees().empty());
+    EXPECT_TRUE(q.isUnivariate());
+    q = std::move(p);
+    EXPECT_TRUE(q.has(x));
+    EXPECT_TRUE(q.isConsistent());
+}
+
+#ifdef CARL_THREAD_SAFE
+TEST(MultivariatePolynomialTest, CachedVariablesConcurrently) {
+    using Poly = MultivariatePolynomial<Rational>;
+    using Degrees = std::vector<std::pair<Variable, std::size_t>>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    const Poly p = Poly(x) * x * y + Rational(3) * y - Rational(1);
+    constexpr std::size_t threads = 4;
+    std::vector<Degrees> results(threads);
+    std::vector<Degrees> copies(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            results[t] = p.variableDegrees();
+            Poly copy = p;
+            copies[t] = copy.variableDegrees();
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    for (std::size_t t = 0; t < threads; ++t) {
+        EXPECT_EQ(Degrees({{x, 2}, {y, 1}}), results[t]);
+        EXPECT_EQ(Degrees({{x, 2}, {y, 1}}), copies[t]);
+    }
+    EXPECT_EQ(&p.variableDegrees(), &p.variableDegrees());
+}
+#endif
@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/PolynomialPool.h"
+
+#include "../Common.h"
+
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace carl;
+
+using Pol = MultivariatePolynomial<Rational>;
+
+TEST(PolynomialPool, sharing) {
+    PolynomialPool<Pol>& pool = PolynomialPool<Pol>::getInstance();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Pol p = Pol(x) * y - Rational(3) * x + Rational(1, 2);
+
+    std::size_t size = pool.size();
+    std::size_t hits = pool.hits();
+    PooledPolynomial<Pol> a(p);
+    PooledPolynomial<Pol> b(Rational(1, 2) - Rational(3) * x + Pol(y) * x);
+    PooledPolynomial<Pol> c(p + Rational(1));
+    EXPECT_EQ(size + 2, pool.size());
+    EXPECT_EQ(hits + 1, pool.hits());
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(&*a, &*b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.id(), b.id());
+    EXPECT_NE(a.id(), c.id());
+    EXPECT_EQ(p, a.polynomial());
+    EXPECT_EQ(std::hash<Pol>()(p), std::hash<PooledPolynomial<Pol>>()(a));
+    EXPECT_EQ(3, a->nrTerms());
+    EXPECT_TRUE(PooledPolynomial<Pol>()->isZero());
+    EXPECT_EQ(PooledPolynomial<Pol>(), PooledPolynomial<Pol>(Pol()));
+}
+
+TEST(PolynomialPool, collect) {
+    PolynomialPool<Pol>& pool = PolynomialPool<Pol>::getInstance();
+    Variable x = freshRealVariable("x");
+    pool.collect();
+    std::size_t size = pool.size();
+    PooledPolynomial<Pol> kept(Pol(x) + Rational(1));
+    {
+        PooledPolynomial<Pol> p(Pol(x) + Rational(2));
+        EXPECT_EQ(size + 2, pool.size());
+    }
+    EXPECT_EQ(1, pool.collect());
+    EXPECT_EQ(size + 1, pool.size());
+    EXPECT_EQ(kept, PooledPolynomial<Pol>(Rational(1) + Pol(x)));
+}
+
+TEST(PolynomialPool, cache) {
+    Variable x = freshRealVariable("x");
+    std::unordered_map<PooledPolynomial<Pol>, int> cache;
+    for (int i = 0; i < 10; ++i) {
+        cache[PooledPolynomial<Pol>(Pol(x) * x + Rational(i % 3))] += 1;
+    }
+    EXPECT_EQ(3, cache.size());
+    EXPECT_EQ(4, cache[PooledPolynomial<Pol>(Pol(x) * x)]);
+}
+
+TEST(PolynomialPool, threads) {
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    std::vector<std::vector<PooledPolynomial<Pol>>> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&results, t, x, y]() {
+            for (int i = 0; i < 100; ++i) {
+                results[t].emplace_back(Pol(x) * Rational(i) + Pol(y));
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t t = 1; t < results.size(); ++t) {
+        EXPECT_EQ(results[0], results[t]);
+    }
+}
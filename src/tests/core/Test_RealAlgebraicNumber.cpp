@@ -56,3 +56,23 @@ TEST(RealAlgebraicNumber, Evaluation2) {
     auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
     std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, RefineAfterCommonPolynomial) {
+    Variable x = freshRealVariable("x");
+    using Pol = UnivariatePolynomial<Rational>;
+    Pol sqr(x, {Rational(-2), Rational(0), Rational(1)});
+    Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+    RealAlgebraicNumber<Rational> a(sqr, i);
+    RealAlgebraicNumber<Rational> b(sqr * Pol(x, {Rational(-3), Rational(1)}), i);
+    for (int n = 0; n < 3; ++n) {
+        b.refine();
+    }
+    // Comparing replaces the polynomial and Sturm sequence of b by the common factor.
+    EXPECT_TRUE(a == b);
+    for (int n = 0; n < 5; ++n) {
+        b.refine();
+        ASSERT_TRUE(b.isInterval());
+        EXPECT_TRUE(b.lower() * b.lower() < Rational(2));
+        EXPECT_TRUE(b.upper() * b.upper() > Rational(2));
+    }
+}
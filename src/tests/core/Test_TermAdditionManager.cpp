@@ -0,0 +1,89 @@
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/util/TermAdditionManager.h>
+#include <gtest/gtest.h>
+
+#include <barrier>
+#include <thread>
+#include <vector>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using TAM = TermAdditionManager<Poly, GrLexOrdering>;
+
+TEST(TermAdditionManager, Strategies) {
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    // Make sure that there are many more monomial ids than terms in a small addition.
+    std::vector<Monomial::Arg> monomials;
+    for (exponent e = 1; e <= 300; ++e) {
+        monomials.push_back(createMonomial(x, e));
+    }
+    TAM tam;
+
+    for (std::size_t size : {std::size_t(2), MonomialPool::getInstance().largestID()}) {
+        auto id = tam.getId(size);
+        EXPECT_EQ(size == 2, tam.isHashed(id));
+        tam.template addTerm<false>(id, Term<Rational>(Rational(2), monomials[10]));
+        tam.template addTerm<false>(id, Term<Rational>(Rational(3), y, 1));
+        tam.template addTerm<false>(id, Term<Rational>(Rational(-2), monomials[10]));
+        tam.template addTerm<false>(id, Term<Rational>(Rational(5)));
+        tam.template addTerm<false>(id, Term<Rational>(Rational(1), y, 1));
+        std::vector<Term<Rational>> terms;
+        tam.readTerms(id, terms);
+        Poly p(std::move(terms));
+        EXPECT_EQ(Poly(4) * Poly(y) + Poly(5), p);
+    }
+    EXPECT_EQ(1, tam.statistics().hashed);
+    EXPECT_EQ(1, tam.statistics().dense);
+
+    // The hash table grows beyond the expected size.
+    auto id = tam.getId(1);
+    EXPECT_TRUE(tam.isHashed(id));
+    for (const auto& m : monomials) {
+        tam.template addTerm<true>(id, Term<Rational>(Rational(1), m));
+    }
+    for (std::size_t i = 0; i < monomials.size(); i += 2) {
+        tam.template addTerm<true>(id, Term<Rational>(Rational(-1), monomials[i]));
+    }
+    std::vector<Term<Rational>> terms;
+    tam.readTerms(id, terms);
+    Poly p(std::move(terms));
+    EXPECT_EQ(monomials.size() / 2, p.nrTerms());
+}
+
+#ifdef CARL_THREAD_SAFE
+TEST(TermAdditionManager, ThreadLocal) {
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Poly base = Poly(x) + Poly(y) + Poly(1);
+    Poly expected = base * base * base * base;
+    constexpr std::size_t threads = 4;
+    std::vector<const TAM*> managers(threads);
+    std::vector<Poly> results(threads);
+    std::vector<std::thread> workers;
+    // Thread local storage may be reused once a thread has exited, hence all managers are obtained while all workers are alive.
+    std::barrier alive(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            managers[t] = &Poly::termAdditionManager();
+            alive.arrive_and_wait();
+            for (std::size_t i = 0; i < 50; ++i) {
+                results[t] = base * base * base * base;
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    for (std::size_t t = 0; t < threads; ++t) {
+        EXPECT_EQ(expected, results[t]);
+        EXPECT_NE(&Poly::termAdditionManager(), managers[t]);
+        for (std::size_t s = t + 1; s < threads; ++s) {
+            EXPECT_NE(managers[s], managers[t]);
+        }
+    }
+}
+#endif
@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <random>
+#include <thread>
 
 #include "../Common.h"
 using namespace carl;
@@ -416,3 +417,345 @@ TEST(UnivariatePolynomial, intervalCoeffs) {
     p *= p;
     p += p;
 }
+
+TEST(UnivariatePolynomial, evaluateBatch) {
+    Variable x = freshRealVariable("x");
+    for (std::size_t degree : {0, 5, 100}) {
+        std::vector<Rational> coeffs;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            coeffs.push_back(Rational(int(i % 7) - 3) / Rational(int(i % 5) + 1));
+        }
+        UnivariatePolynomial<Rational> p(x, coeffs);
+        for (std::size_t points : {1, 10, 100}) {
+            std::vector<Rational> values;
+            for (std::size_t i = 0; i < points; ++i) {
+                values.push_back(Rational(int(i) - 50) / Rational(7));
+            }
+            std::vector<Rational> res = p.evaluateBatch(values);
+            ASSERT_EQ(points, res.size());
+            for (std::size_t i = 0; i < points; ++i) {
+                EXPECT_EQ(p.evaluate(values[i]), res[i]);
+            }
+        }
+    }
+    EXPECT_EQ(std::vector<Rational>(2, Rational(0)), UnivariatePolynomial<Rational>(x).evaluateBatch({Rational(1), Rational(2)}));
+    UnivariatePolynomial<mpz_class> q(x, {mpz_class(1), mpz_class(-2), mpz_class(3)});
+    EXPECT_EQ(std::vector<mpz_class>({mpz_class(2), mpz_class(1), mpz_class(6)}), q.evaluateBatch({mpz_class(1), mpz_class(0), mpz_class(-1)}));
+}
+
+namespace {
+template<typename C, typename F>
+void checkMultiplication(Variable x, F&& coeff) {
+    std::vector<std::pair<std::size_t, std::size_t>> sizes = {{1, 1}, {3, 20}, {20, 20}, {40, 40}, {33, 100}, {100, 7}, {150, 200}};
+    for (const auto& s : sizes) {
+        std::vector<C> lhs;
+        std::vector<C> rhs;
+        for (std::size_t i = 0; i < s.first; ++i) lhs.push_back(coeff(i));
+        for (std::size_t i = 0; i < s.second; ++i) rhs.push_back(coeff(3 * i + 1));
+        std::vector<C> expected(s.first + s.second - 1, C(0));
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            for (std::size_t j = 0; j < rhs.size(); ++j) {
+                expected[i + j] += lhs[i] * rhs[j];
+            }
+        }
+        UnivariatePolynomial<C> p(x, lhs);
+        UnivariatePolynomial<C> q(x, rhs);
+        EXPECT_EQ(UnivariatePolynomial<C>(x, expected), p * q);
+        EXPECT_EQ(UnivariatePolynomial<C>(x, expected), q * p);
+        UnivariatePolynomial<C> square = p * UnivariatePolynomial<C>(p);
+        p *= p;
+        EXPECT_EQ(square, p);
+    }
+}
+}  // namespace
+
+TEST(UnivariatePolynomial, Multiplication) {
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    checkMultiplication<mpz_class>(x, [](std::size_t i) { return (i % 5 == 2) ? mpz_class(0) : mpz_class(int(i % 11) - 5) * (mpz_class(1) << int(i % 70)); });
+    checkMultiplication<Rational>(x, [](std::size_t i) { return Rational(int(i % 13) - 6) / Rational(int(i % 4) + 1); });
+    checkMultiplication<double>(x, [](std::size_t i) { return double(int(i % 9) - 4); });
+    using Pol = MultivariatePolynomial<Rational>;
+    checkMultiplication<Pol>(x, [y](std::size_t i) { return Pol(y) * Rational(int(i % 3) - 1) + Rational(int(i % 7)); });
+
+    // Interval coefficients are multiplied by schoolbook multiplication, which gives the tightest enclosure.
+    std::vector<Interval<double>> intervals;
+    for (std::size_t i = 0; i < 100; ++i) {
+        intervals.emplace_back(double(int(i % 9) - 4), double(int(i % 9) - 3));
+    }
+    std::vector<Interval<double>> square(2 * intervals.size() - 1, Interval<double>(0));
+    for (std::size_t i = 0; i < intervals.size(); ++i) {
+        for (std::size_t j = 0; j < intervals.size(); ++j) {
+            square[i + j] += intervals[i] * intervals[j];
+        }
+    }
+    UnivariatePolynomial<Interval<double>> ip(x, intervals);
+    auto isquare = ip * ip;
+    ASSERT_EQ(square.size(), isquare.coefficients().size());
+    for (std::size_t i = 0; i < square.size(); ++i) {
+        EXPECT_EQ(square[i], isquare.coefficients()[i]);
+    }
+
+    UnivariatePolynomial<Rational> p(x, std::vector<Rational>(50, Rational(1, 2)));
+    EXPECT_TRUE((p * UnivariatePolynomial<Rational>(x)).isZero());
+    EXPECT_EQ(UnivariatePolynomial<Rational>(x, std::vector<Rational>(50, Rational(1, 4))), p * UnivariatePolynomial<Rational>(x, Rational(1, 2)));
+}
+
+TEST(UnivariatePolynomial, LargeDivision) {
+    Variable x = freshRealVariable("x");
+    auto poly = [x](std::size_t degree, std::size_t seed) {
+        std::vector<Rational> coeffs;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            coeffs.push_back(Rational(int((i * 37 + seed) % 201) - 100) / Rational(int((i + seed) % 7) + 1));
+        }
+        return UnivariatePolynomial<Rational>(x, coeffs);
+    };
+    std::vector<std::pair<std::size_t, std::size_t>> degrees = {{10, 3}, {50, 49}, {80, 40}, {150, 33}, {200, 100}, {300, 35}};
+    for (const auto& d : degrees) {
+        UnivariatePolynomial<Rational> a = poly(d.first, 1);
+        UnivariatePolynomial<Rational> b = poly(d.second, 5);
+        auto res = a.divideBy(b);
+        EXPECT_EQ(a, res.quotient * b + res.remainder);
+        EXPECT_TRUE(res.remainder.isZero() || res.remainder.degree() < b.degree());
+        EXPECT_EQ(d.first - d.second, res.quotient.degree());
+        EXPECT_EQ(res.remainder, a.remainder(b));
+        UnivariatePolynomial<Rational> r = poly(d.second - 1, 3);
+        EXPECT_EQ(r, (a * b + r).remainder(b));
+        EXPECT_EQ(a, (a * b + r).divideBy(b).quotient);
+    }
+}
+
+TEST(UnivariatePolynomial, PseudoDivision) {
+    Variable x = freshRealVariable("x");
+    auto poly = [x](std::size_t degree, std::size_t seed) {
+        std::vector<mpz_class> coeffs;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            coeffs.push_back(mpz_class(int((i * 37 + seed) % 201) - 100));
+        }
+        return UnivariatePolynomial<mpz_class>(x, coeffs);
+    };
+    std::vector<std::pair<std::size_t, std::size_t>> degrees = {{0, 0}, {5, 7}, {10, 3}, {50, 49}, {80, 40}, {150, 33}, {200, 100}};
+    for (const auto& d : degrees) {
+        UnivariatePolynomial<mpz_class> a = poly(d.first, 1);
+        UnivariatePolynomial<mpz_class> b = poly(d.second, 5);
+        auto res = a.pseudoDivideBy(b);
+        std::size_t power = (d.first < d.second) ? 0 : d.first - d.second + 1;
+        EXPECT_EQ(a * carl::pow(b.lcoeff(), carl::uint(power)), res.quotient * b + res.remainder);
+        EXPECT_TRUE(res.remainder.isZero() || res.remainder.degree() < b.degree());
+    }
+
+    using Pol = MultivariatePolynomial<Rational>;
+    Variable y = freshRealVariable("y");
+    UnivariatePolynomial<Pol> a(x, {Pol(y), Pol(1), Pol(y) * y, Pol(y) - Rational(2)});
+    UnivariatePolynomial<Pol> b(x, {Pol(3), Pol(y) + Rational(1)});
+    auto res = a.pseudoDivideBy(b);
+    EXPECT_EQ(a * carl::pow(b.lcoeff(), 3), res.quotient * b + res.remainder);
+    EXPECT_EQ(a.prem(b), res.remainder);
+}
+
+TEST(UnivariatePolynomial, HalfGCD) {
+    Variable x = freshRealVariable("x");
+    using GFPol = UnivariatePolynomial<GFNumber<mpz_class>>;
+    const GaloisField<mpz_class>* gf = GaloisFieldManager<mpz_class>::getInstance().getField(10007);
+    auto poly = [x, gf](std::size_t degree, std::size_t seed) {
+        std::vector<mpz_class> coeffs;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            coeffs.push_back(mpz_class(int((i * i * 7919 + i * 104729 + seed * 31) % 10007)));
+        }
+        coeffs.back() = 1;
+        return UnivariatePolynomial<mpz_class>(x, coeffs).toFiniteDomain(gf);
+    };
+    std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> degrees = {{20, 10, 5}, {40, 35, 100}, {100, 60, 80}, {150, 149, 70}, {200, 130, 1}, {130, 130, 129}};
+    for (const auto& d : degrees) {
+        GFPol f = poly(std::get<2>(d), 3);
+        GFPol a = poly(std::get<0>(d), 1) * f;
+        GFPol b = poly(std::get<1>(d), 2) * f;
+        GFPol s(x);
+        GFPol t(x);
+        GFPol g = GFPol::extended_gcd(a, b, s, t);
+        EXPECT_EQ(g, s * a + t * b);
+        EXPECT_TRUE(g.isNormal());
+        EXPECT_TRUE(a.divideBy(g).remainder.isZero());
+        EXPECT_TRUE(b.divideBy(g).remainder.isZero());
+        EXPECT_TRUE(f.divideBy(g).remainder.isZero() || g.degree() >= f.degree());
+        EXPECT_EQ(g, GFPol::gcd(a, b));
+        EXPECT_EQ(g, GFPol::gcd(b, a));
+    }
+}
+
+TEST(UnivariatePolynomial, ModularGCD) {
+    Variable x = freshRealVariable("x");
+    using Pol = UnivariatePolynomial<Rational>;
+    auto poly = [x](std::size_t degree, std::size_t seed, int scale) {
+        std::vector<Rational> coeffs;
+        for (std::size_t i = 0; i <= degree; ++i) {
+            coeffs.push_back(Rational(int((i * 37 + seed * 11) % 201) - 100) * scale / Rational(int((i + seed) % 5) + 1));
+        }
+        return Pol(x, coeffs);
+    };
+    std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> degrees = {{10, 8, 0}, {20, 15, 5}, {40, 40, 12}, {60, 30, 30}};
+    for (const auto& d : degrees) {
+        Pol f = poly(std::get<2>(d), 3, 1);
+        Pol a = poly(std::get<0>(d), 1, 1) * f;
+        Pol b = poly(std::get<1>(d), 2, 1) * f;
+        Pol s(x);
+        Pol t(x);
+        Pol g = Pol::gcd(a, b);
+        EXPECT_EQ(Pol::extended_gcd(a, b, s, t), g);
+        EXPECT_TRUE(g.isNormal());
+        EXPECT_TRUE(a.divideBy(g).remainder.isZero());
+        EXPECT_TRUE(b.divideBy(g).remainder.isZero());
+        EXPECT_TRUE(g.divideBy(f.normalized()).remainder.isZero());
+    }
+
+    // Large coefficients and leading coefficients sharing many primes.
+    Pol f = poly(12, 7, 1000003);
+    Pol a = Pol(x, {Rational(1), Rational(0), Rational(0), Rational(0), Rational(0), Rational(0), Rational(0), Rational(0), Rational(0), Rational(510510)}) * f;
+    Pol b = poly(15, 4, 1) * Rational(9699690) * f;
+    Pol g = Pol::gcd(a, b);
+    EXPECT_TRUE(a.divideBy(g).remainder.isZero());
+    EXPECT_TRUE(b.divideBy(g).remainder.isZero());
+    EXPECT_TRUE(g.divideBy(f.normalized()).remainder.isZero());
+
+    // Coprime polynomials.
+    EXPECT_EQ(Pol(x, Rational(1)), Pol::gcd(Pol(x, 1, 20) + Rational(1), Pol(x, 1, 12) + Rational(2)));
+
+    // Integer coefficients keep the content.
+    using IPol = UnivariatePolynomial<mpz_class>;
+    IPol h = IPol(x, {mpz_class(3), mpz_class(0), mpz_class(-5), mpz_class(7), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(2)});
+    IPol c = IPol(x, {mpz_class(-1), mpz_class(4), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(3)});
+    IPol e = IPol(x, {mpz_class(5), mpz_class(1), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(0), mpz_class(1), mpz_class(0), mpz_class(1)});
+    EXPECT_EQ(h * mpz_class(6), IPol::gcd(h * c * mpz_class(12), h * e * mpz_class(-18)));
+}
+
+TEST(UnivariatePolynomial, FiniteFieldFactorization) {
+    Variable x = freshRealVariable("x");
+    const GaloisField<mpz_class>* gf = GaloisFieldManager<mpz_class>::getInstance().getField(10007);
+    using Pol = UnivariatePolynomial<GFNumber<mpz_class>>;
+    std::mt19937 generator(4711);
+    std::uniform_int_distribution<int> distribution(0, 10006);
+    auto poly = [&](std::size_t degree) {
+        std::vector<GFNumber<mpz_class>> coeffs;
+        for (std::size_t i = 0; i < degree; ++i) {
+            coeffs.emplace_back(distribution(generator), gf);
+        }
+        coeffs.emplace_back(1, gf);
+        return Pol(x, coeffs);
+    };
+
+    for (std::size_t degree : {1, 2, 7, 20, 40}) {
+        Pol p = poly(degree) * poly(degree / 2 + 3) * poly(3);
+        if (!Pol::gcd(p, p.derivative()).isConstant())
+            continue;
+        auto factors = finiteFieldFactorization(p);
+        EXPECT_LE(3, factors.size());
+        Pol product(x, GFNumber<mpz_class>(1, gf));
+        for (const auto& f : factors) {
+            EXPECT_TRUE(f.isNormal());
+            product *= f;
+        }
+        EXPECT_EQ(p, product);
+    }
+}
+
+TEST(UnivariatePolynomial, IntegerFactorization) {
+    Variable x = freshRealVariable("x");
+    using IPol = UnivariatePolynomial<mpz_class>;
+    // Irreducible by Eisenstein's criterion for 2 and 3.
+    auto eisenstein = [&](std::size_t k, int c) { return IPol(x, mpz_class(1), k) + IPol(x, {mpz_class(c), mpz_class(c)}); };
+
+    // Swinnerton-Dyer polynomial, it splits into linear or quadratic factors modulo every prime.
+    IPol swinnertonDyer(x, {mpz_class(1), mpz_class(0), mpz_class(-10), mpz_class(0), mpz_class(1)});
+    EXPECT_EQ(1, squareFreeIntegerFactorization(swinnertonDyer).size());
+
+    IPol p(x, mpz_class(1));
+    std::size_t count = 0;
+    for (std::size_t k = 5; k <= 15; ++k, ++count) {
+        p *= eisenstein(k, k % 2 == 0 ? 2 : 3);
+    }
+    p *= IPol(x, {mpz_class(-1), mpz_class(7)});
+    p *= swinnertonDyer;
+    count += 2;
+    ASSERT_LE(100, p.degree());
+    auto factors = squareFreeIntegerFactorization(p);
+    EXPECT_EQ(count, factors.size());
+    IPol product(x, mpz_class(1));
+    for (const auto& f : factors) {
+        product *= f;
+    }
+    EXPECT_EQ(p, product);
+
+    // x^60 - 1 is the product of the cyclotomic polynomials of the divisors of 60.
+    EXPECT_EQ(12, squareFreeIntegerFactorization(IPol(x, mpz_class(1), 60) - IPol(x, mpz_class(1))).size());
+
+    // Factors are recovered through the rational factorization together with their multiplicities.
+    using Pol = UnivariatePolynomial<Rational>;
+    Pol q = Pol(x, {Rational(2), Rational(0), Rational(0), Rational(0), Rational(1)}) * Pol(x, {Rational(3), Rational(0), Rational(0), Rational(1)});
+    Pol r = q * q * Pol(x, {Rational(1), Rational(0), Rational(0), Rational(0), Rational(0), Rational(1)}) * Rational(-3, 4);
+    auto factorMap = r.factorization();
+    Pol productOfFactors(x, Rational(1));
+    for (const auto& f : factorMap) {
+        for (std::size_t i = 0; i < f.second; ++i) {
+            productOfFactors *= f.first;
+        }
+    }
+    EXPECT_EQ(r, productOfFactors);
+    EXPECT_EQ(2, factorMap.at(Pol(x, {Rational(2), Rational(0), Rational(0), Rational(0), Rational(1)})));
+    // x^5 + 1 = (x + 1) (x^4 - x^3 + x^2 - x + 1)
+    EXPECT_EQ(1, factorMap.at(Pol(x, {Rational(1), Rational(-1), Rational(1), Rational(-1), Rational(1)})));
+}
+
+TEST(UnivariatePolynomial, SturmSequence) {
+    Variable x = freshRealVariable("x");
+    using Pol = UnivariatePolynomial<Rational>;
+    Pol p = Pol(x, {Rational(-1), Rational(1)}) * Pol(x, {Rational(-2), Rational(1)}) * Pol(x, {Rational(-3), Rational(1)}) * Pol(x, {Rational(1), Rational(0), Rational(1)});
+    p *= Rational(-2, 3);
+
+    EXPECT_EQ(3, p.countRealRoots(Interval<Rational>(0, BoundType::STRICT, 4, BoundType::STRICT)));
+    EXPECT_EQ(2, p.countRealRoots(Interval<Rational>(Rational(1, 2), BoundType::STRICT, Rational(5, 2), BoundType::STRICT)));
+    EXPECT_EQ(0, p.countRealRoots(Interval<Rational>(Rational(-7, 3), BoundType::STRICT, Rational(1, 3), BoundType::STRICT)));
+
+    // The sequence is cached and shared by copies.
+    auto seq = p.sturmSequence();
+    EXPECT_EQ(seq, p.sturmSequence());
+    Pol q = p;
+    EXPECT_EQ(seq, q.sturmSequence());
+    // It is recomputed once the polynomial changes.
+    q *= Pol(x, {Rational(-1, 2), Rational(1)});
+    EXPECT_NE(seq, q.sturmSequence());
+    EXPECT_EQ(3, q.countRealRoots(Interval<Rational>(0, BoundType::STRICT, Rational(5, 2), BoundType::STRICT)));
+
+    // The integral evaluation agrees with evaluating the rational sequence.
+    auto list = p.standardSturmSequence();
+    for (int i = -8; i < 16; ++i) {
+        Interval<Rational> interval(Rational(2 * i + 1, 7), BoundType::STRICT, Rational(2 * i + 19, 5), BoundType::STRICT);
+        EXPECT_EQ(Pol::countRealRoots(list, interval), seq->countRealRoots(interval));
+    }
+}
+
+#ifdef CARL_THREAD_SAFE
+TEST(UnivariatePolynomial, SturmSequenceConcurrently) {
+    Variable x = freshRealVariable("x");
+    using Pol = UnivariatePolynomial<Rational>;
+    const Pol p = Pol(x, {Rational(-1), Rational(1)}) * Pol(x, {Rational(-2), Rational(1)}) * Pol(x, {Rational(-3), Rational(1)});
+    constexpr std::size_t threads = 4;
+    std::vector<std::shared_ptr<const SturmSequence<Rational>>> sequences(threads);
+    std::vector<int> roots(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            sequences[t] = p.sturmSequence();
+            for (int i = 0; i < 100; ++i) {
+                roots[t] = p.countRealRoots(Interval<Rational>(Rational(-i, 100), BoundType::STRICT, Rational(5, 2), BoundType::STRICT));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    for (std::size_t t = 0; t < threads; ++t) {
+        EXPECT_EQ(p.sturmSequence(), sequences[t]);
+        EXPECT_EQ(2, roots[t]);
+    }
+}
+#endif